@@ -1,47 +1,106 @@
-/*******************************************************************************
- * @file config.h
- *
- * @author Alexy Torres Aurora Dugo
- *
- * @date 24/06/2020
- *
- * @version 1.0
- *
- * @brief STM32-F401RE global configuration file.
- *
- * @details STM32-F401RE global configuration file. This file contains all the
- * settings that the user can set before generating the kernel's binary.
- ******************************************************************************/
-
-#ifndef __GLOBAL_CONFIG_H__
-#define __GLOBAL_CONFIG_H__
-
-#include "serial_settings.h"
-
-/** Kernel's serial settings. */
-#define CONFIG_UART_SETTINGS {                  \
-    .baudrate    = 115200,                      \
-    .word_length = 8,                           \
-    .stop_bits   = SERIAL_STOP_BITS_1,          \
-    .partity     = SERIAL_PARITY_NONE,          \
-    .ctrl_flow   = SERIAL_CTRL_FLOW_NONE        \
-}
-
-/* Main timer tick frequency in Hz */
-#define CONFIG_MAIN_TIMER_TICK_FREQ 100
-
-/* Maximum number of interrupts lines to manage */
-#define CONFIG_MAX_INTERRUPT_LINES 68
-
-/* Kernel log level */
-#define ERROR_LOG_LEVEL   3
-#define WARNING_LOG_LEVEL 2
-#define INFO_LOG_LEVEL    1
-#define NONE_LOG_LEVEL    0
-
-#define KERNEL_LOG_LEVEL ERROR_LOG_LEVEL
-
-/* Architecture type */
-#define ARCH_32_BITS
-
+/*******************************************************************************
+ * @file config.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 24/06/2020
+ *
+ * @version 1.0
+ *
+ * @brief STM32-F401RE global configuration file.
+ *
+ * @details STM32-F401RE global configuration file. This file contains all the
+ * settings that the user can set before generating the kernel's binary.
+ ******************************************************************************/
+
+#ifndef __GLOBAL_CONFIG_H__
+#define __GLOBAL_CONFIG_H__
+
+#ifndef __ASSEMBLER__
+#include "serial_settings.h"
+#endif
+
+/** Kernel's serial settings. */
+#define CONFIG_UART_SETTINGS {                  \
+    .baudrate    = 115200,                      \
+    .word_length = 8,                           \
+    .stop_bits   = SERIAL_STOP_BITS_1,          \
+    .partity     = SERIAL_PARITY_NONE,          \
+    .ctrl_flow   = SERIAL_CTRL_FLOW_NONE        \
+}
+
+/* Serial transmission buffer size in bytes (power of two) */
+#define CONFIG_SERIAL_TX_BUFFER_SIZE 1024
+
+/* Main timer tick frequency in Hz */
+#define CONFIG_MAIN_TIMER_TICK_FREQ 100
+
+/* Maximum number of external interrupts lines to manage */
+#define CONFIG_MAX_INTERRUPT_LINES 84
+
+/* Kernel interrupt priority ceiling (1-15). The kernel critical sections mask
+ * the interrupts with a priority value greater or equal to the ceiling. The
+ * interrupts with a higher priority are never masked and must not call the
+ * kernel API.
+ */
+#define CONFIG_KERNEL_INT_PRIORITY_CEILING 4
+
+/* Number of task priority levels (at most 32), 0 being the highest priority */
+#define CONFIG_SCHED_PRIORITY_COUNT 32
+
+/* Idle task stack size in bytes */
+#define CONFIG_SCHED_IDLE_STACK_SIZE 256
+
+/* Set to 1 to suppress the system ticks while the idle task runs */
+#define CONFIG_SCHED_TICKLESS_IDLE 1
+
+/* Main task (user_main) priority and stack size in bytes (power of two) */
+#define CONFIG_MAIN_TASK_PRIORITY   16
+#define CONFIG_MAIN_TASK_STACK_SIZE 1024
+
+/* Set to 1 to enable the CPU cycle counter and the profiling probes */
+#define CONFIG_CPU_PROFILE_ENABLED 1
+
+/* Set to 1 to run the kernel benchmarks at boot, the cycle counts are logged
+ * as profiling probes. Requires CONFIG_CPU_PROFILE_ENABLED.
+ */
+#define CONFIG_KERNEL_BENCH_ENABLED    0
+#define CONFIG_KERNEL_BENCH_ITERATIONS 1000
+
+/* Kernel log levels, a level enables its messages and the more severe ones */
+#define NONE_LOG_LEVEL    0
+#define ERROR_LOG_LEVEL   1
+#define WARNING_LOG_LEVEL 2
+#define INFO_LOG_LEVEL    3
+
+/* Default log level of the modules */
+#define KERNEL_LOG_LEVEL INFO_LOG_LEVEL
+
+/* Per-module log levels, the disabled levels are removed from the image */
+#define CONFIG_LOG_LEVEL_CORE          KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_CPU           KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_CPU_TIMER     KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_IO            KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_BSP_CLOCKS    KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_BSP_FLASH     KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_BSP_GPIO      KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_BSP_POWER     KERNEL_LOG_LEVEL
+#define CONFIG_LOG_LEVEL_BSP_USART     KERNEL_LOG_LEVEL
+
+/* Set to 1 to send the logs as binary frames, decoded on the host with 
+ * Tools/log_decoder.py and the kernel ELF file
+ */
+#define CONFIG_LOG_BINARY 0
+
+/* Set to 1 to keep a copy of the logs and the panic record in a memory 
+ * region retained across resets, sent to the log output on the next boot
+ */
+#define CONFIG_CRASH_LOG_ENABLED 1
+
+/* Retained crash log size in bytes (power of two) */
+#define CONFIG_CRASH_LOG_SIZE 1024
+
+/* Architecture type */
+#define ARCH_32_BITS
+
 #endif /* #ifndef __GLOBAL_CONFIG_H__ */
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "stdint.h"
 #include "stddef.h"
 #include "error_types.h"
+#include "types.h"
 
 /*******************************************************************************
  * DEFINES
@@ -35,13 +36,14 @@
 /**
  * @brief Writes a log message to the log buffer or log output.
  * 
- * @details Writes a log message to the log buffer or log output. The 
+ * @details Writes a log message to the log buffer or log output. The message
+ * is given as a set of buffers, written in order as a single record. The 
  * implementation of the buffer or output is free and left to the BSP design 
  * choices.
  * 
- * @param[in] str The message to be written to the log buffer or output.
- * @param[in] length The size of the message to be written.
+ * @param[in] vector The buffers forming the message.
+ * @param[in] count The number of buffers in the vector.
  */
-void bsp_logger_write_hook (const char* str, const size_t length);
+void bsp_logger_write_hook(const IO_VECTOR_T* vector, const size_t count);
 
 #endif /* #ifndef __BOARD_LOGGER_H__ */
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include "stddef.h"
 #include "serial_settings.h"
 #include "error_types.h"
+#include "types.h"
 
 /*******************************************************************************
  * DEFINES
@@ -82,4 +83,77 @@ ERROR_CODE_E serial_init(const SERIAL_SETTINGS_T* settings);
  */
 ERROR_CODE_E serial_write(const char* str, const size_t length);
 
+/**
+ * @brief Enables the interrupt driven transmission of the serial line.
+ * 
+ * @details Enables the interrupt driven transmission of the serial line. 
+ * After this call, serial_write_async queues the data, which is sent by the
+ * transmit interrupt handler. The kernel interrupts must be initialized.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E serial_enable_async(void);
+
+/**
+ * @brief Queues a string of characters to the serial line.
+ * 
+ * @details Queues a string of characters in the serial transmission buffer, 
+ * without waiting for the serial line. If the string does not fit in the 
+ * buffer, it is dropped and the drop counter is incremented. Before the 
+ * interrupt driven transmission is enabled, the string is written with 
+ * serial_write. This function can be called from the tasks and the 
+ * interrupts managed by the kernel, but not from the interrupts above the 
+ * kernel priority ceiling.
+ * 
+ * @param[in] str The string to send to the serial line.
+ * @param[in] length The length of the string to send to the serial line.
+ * 
+ * @return NO_ERROR is returned in case of success. ERROR_NO_MEMORY is 
+ * returned if the string was dropped. Otherwise an error code is returned. 
+ * Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E serial_write_async(const char* str, const size_t length);
+
+/**
+ * @brief Queues a set of buffers to the serial line.
+ * 
+ * @details Queues a set of buffers in the serial transmission buffer as one
+ * contiguous string, without waiting for the serial line. The space for all
+ * the buffers is reserved at once: if they do not fit, they are all dropped 
+ * and the drop counter is incremented. Before the interrupt driven 
+ * transmission is enabled, the buffers are written with serial_write. This 
+ * function can be called from the tasks and the interrupts managed by the
+ * kernel, but not from the interrupts above the kernel priority ceiling.
+ * 
+ * @param[in] vector The buffers to send to the serial line.
+ * @param[in] count The number of buffers in the vector.
+ * 
+ * @return NO_ERROR is returned in case of success. ERROR_NO_MEMORY is 
+ * returned if the buffers were dropped. Otherwise an error code is returned. 
+ * Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E serial_writev_async(const IO_VECTOR_T* vector, 
+                                 const size_t count);
+
+/**
+ * @brief Sends the queued characters to the serial line.
+ * 
+ * @details Sends the characters queued in the serial transmission buffer by
+ * polling the serial line. This is intended for contexts where the transmit 
+ * interrupt cannot be served, such as a kernel panic. This must be called 
+ * with interrupts disabled.
+ */
+void serial_flush(void);
+
+/**
+ * @brief Gets the number of strings dropped by the serial transmission.
+ * 
+ * @param[out] count The pointer to store the number of dropped strings.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E serial_get_drop_count(uint32_t* count);
+
 #endif /* #ifndef __BOARD_SERIAL_H__ */
\ No newline at end of file
@@ -158,6 +158,9 @@
 /** @brief BRR divider mantissa field offset. */
 #define USART_BRR_DIV_MANT_OFFSET 4
 
+/** @brief USART2 global interrupt external line. */
+#define USART2_IRQ_LINE 38
+
 /*******************************************************************************
  * STRUCTURES
  ******************************************************************************/
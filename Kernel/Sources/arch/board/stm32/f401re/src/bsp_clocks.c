@@ -13,6 +13,8 @@
  * routines used to manage the STM32 F401RE and timers clocks.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_BSP_CLOCKS
+
 #include "error_types.h"
 #include "bsp_clocks.h"
 #include "bsp_flash.h"
@@ -13,6 +13,8 @@
  * routines used to manage the BSP flash, cache and prefetch unit.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_BSP_FLASH
+
 #include "error_types.h"
 #include "bsp_flash.h"
 #include "cpu_api.h"
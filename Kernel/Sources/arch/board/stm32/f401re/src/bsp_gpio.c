@@ -13,6 +13,8 @@
  * routines used to manage the GPIO present on the board
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_BSP_GPIO
+
 #include "error_types.h"
 #include "bsp_gpio.h"
 #include "stdint.h"
@@ -43,26 +45,20 @@
     if(value != GPIO_MODE_ANALOG && value != GPIO_MODE_ALTFUN &&                \
        value != GPIO_MODE_OUTPUT && value != GPIO_MODE_INPUT)                   \
     {                                                                           \
-        if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)                                 \
-        {                                                                       \
-            KERNEL_LOG_ERROR("Invalid GPIO mode/type",                          \
-                             (void*)&modetype,                                  \
-                             sizeof(modetype),                                  \
-                             ERROR_INVALID_PARAM);                              \
-        }                                                                       \
+        KERNEL_LOG_ERROR("Invalid GPIO mode/type",                              \
+                         (void*)&modetype,                                      \
+                         sizeof(modetype),                                      \
+                         ERROR_INVALID_PARAM);                                  \
                                                                                 \
         return ERROR_INVALID_PARAM;                                             \
     }                                                                           \
     value = modetype & GPIO_TYPE_MASK;                                          \
     if(value != GPIO_TYPE_OPENDRAIN && value != GPIO_TYPE_PUSHPULL)             \
     {                                                                           \
-        if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)                                 \
-        {                                                                       \
-            KERNEL_LOG_ERROR("Invalid GPIO mode/type",                          \
-                             (void*)&modetype,                                  \
-                             sizeof(modetype),                                  \
-                             ERROR_INVALID_PARAM);                              \
-        }                                                                       \
+        KERNEL_LOG_ERROR("Invalid GPIO mode/type",                              \
+                         (void*)&modetype,                                      \
+                         sizeof(modetype),                                      \
+                         ERROR_INVALID_PARAM);                                  \
                                                                                 \
         return ERROR_INVALID_PARAM;                                             \
     }                                                                           \
@@ -70,13 +66,10 @@
     if(value != GPIO_PUPD_PD && value != GPIO_PUPD_PU &&                        \
        value != GPIO_PUPD_NONE)                                                 \
     {                                                                           \
-        if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)                                 \
-        {                                                                       \
-            KERNEL_LOG_ERROR("Invalid GPIO mode/type",                          \
-                             (void*)&modetype,                                  \
-                             sizeof(modetype),                                  \
-                             ERROR_INVALID_PARAM);                              \
-        }                                                                       \
+        KERNEL_LOG_ERROR("Invalid GPIO mode/type",                              \
+                         (void*)&modetype,                                      \
+                         sizeof(modetype),                                      \
+                         ERROR_INVALID_PARAM);                                  \
                                                                                 \
         return ERROR_INVALID_PARAM;                                             \
     }                                                                           \
@@ -95,13 +88,10 @@
 ({                                                                           \
     if(speed > GPIO_SPEED_VERY_HIGH)                                         \
     {                                                                        \
-        if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)                              \
-        {                                                                    \
-            KERNEL_LOG_ERROR("Invalid GPIO speed",                           \
-                             (void*)&speed,                                  \
-                             sizeof(speed),                                  \
-                             ERROR_INVALID_PARAM);                           \
-        }                                                                    \
+        KERNEL_LOG_ERROR("Invalid GPIO speed",                               \
+                         (void*)&speed,                                      \
+                         sizeof(speed),                                      \
+                         ERROR_INVALID_PARAM);                               \
                                                                              \
         return ERROR_INVALID_PARAM;                                          \
     }                                                                        \
@@ -120,13 +110,10 @@
 ({                                                                           \
     if(altfunc > GPIO_ALFUNC_15)                                             \
     {                                                                        \
-        if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)                              \
-        {                                                                    \
-            KERNEL_LOG_ERROR("Invalid GPIO alternative function",            \
-                             (void*)&altfunc,                                \
-                             sizeof(altfunc),                                \
-                             ERROR_INVALID_PARAM);                           \
-        }                                                                    \
+        KERNEL_LOG_ERROR("Invalid GPIO alternative function",                \
+                         (void*)&altfunc,                                    \
+                         sizeof(altfunc),                                    \
+                         ERROR_INVALID_PARAM);                               \
                                                                              \
         return ERROR_INVALID_PARAM;                                          \
     }                                                                        \
@@ -31,8 +31,10 @@
  * Public functions
  ******************************************************************************/
 
-void bsp_logger_write_hook (const char* str, const size_t length)
+void bsp_logger_write_hook(const IO_VECTOR_T* vector, const size_t count)
 {
-    /* Writes the log to the serial output */
-    serial_write(str, length);
+    /* Queues the log to the serial output, it is sent by the serial line
+     * transmit interrupt
+     */
+    (void)serial_writev_async(vector, count);
 }
\ No newline at end of file
@@ -13,6 +13,8 @@
  * routines used to manage the STM32 F401RE power.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_BSP_POWER
+
 #include "error_types.h"
 #include "bsp_power.h"
 #include "stdint.h"
@@ -15,6 +15,8 @@
  * @warning The module is developped to use the USART2.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_BSP_USART
+
 #include "error_types.h"
 #include "bsp_usart.h"
 #include "bsp_clocks.h"
@@ -22,6 +24,10 @@
 #include "config.h"
 #include "stddef.h"
 #include "logger.h"
+#include "cpu_api.h"
+#include "cpu_interrupt.h"
+#include "interrupts.h"
+#include "ring_buffer.h"
 
 /*******************************************************************************
  * Private Data
@@ -30,6 +36,18 @@
 /** @brief Current usart initialization state. */
 uint8_t usart_init_state = 0;
 
+/** @brief Set when the transmission is interrupt driven. */
+static uint8_t usart_async_state = 0;
+
+/** @brief Transmission ring buffer storage. */
+static uint8_t usart_tx_storage[CONFIG_SERIAL_TX_BUFFER_SIZE];
+
+/** @brief Transmission ring buffer, drained by the transmit interrupt. */
+static SPSC_RING_BUFFER_T usart_tx_ring;
+
+/** @brief Number of strings dropped because the ring buffer was full. */
+static volatile uint32_t usart_tx_dropped = 0;
+
 /*******************************************************************************
  * Private functions
  ******************************************************************************/
@@ -60,13 +78,10 @@ uint8_t usart_init_state = 0;
         case 1843200:                                       \
             break;                                          \
         default:                                            \
-            if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)         \
-            {                                               \
-                KERNEL_LOG_ERROR("Invalid USART baudrate",  \
-                                 (void*)&baudrate,          \
-                                 sizeof(baudrate),          \
-                                 ERROR_INVALID_PARAM);      \
-            }                                               \
+            KERNEL_LOG_ERROR("Invalid USART baudrate",      \
+                             (void*)&baudrate,              \
+                             sizeof(baudrate),              \
+                             ERROR_INVALID_PARAM);          \
                                                             \
             return ERROR_INVALID_PARAM;                     \
                                                             \
@@ -90,13 +105,10 @@ uint8_t usart_init_state = 0;
         case 9:                                                \
             break;                                             \
         default:                                               \
-            if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)            \
-            {                                                  \
-                KERNEL_LOG_ERROR("Invalid USART word length",  \
-                                 (void*)&wdlength,             \
-                                 sizeof(wdlength),             \
-                                 ERROR_INVALID_PARAM);         \
-            }                                                  \
+            KERNEL_LOG_ERROR("Invalid USART word length",      \
+                             (void*)&wdlength,                 \
+                             sizeof(wdlength),                 \
+                             ERROR_INVALID_PARAM);             \
                                                                \
             return ERROR_INVALID_PARAM;                        \
                                                                \
@@ -122,13 +134,10 @@ uint8_t usart_init_state = 0;
         case SERIAL_STOP_BITS_2:                               \
             break;                                             \
         default:                                               \
-            if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)            \
-            {                                                  \
-                KERNEL_LOG_ERROR("Invalid USART stop bits",    \
-                                 (void*)&stpbits,              \
-                                 sizeof(stpbits),              \
-                                 ERROR_INVALID_PARAM);         \
-            }                                                  \
+            KERNEL_LOG_ERROR("Invalid USART stop bits",        \
+                             (void*)&stpbits,                  \
+                             sizeof(stpbits),                  \
+                             ERROR_INVALID_PARAM);             \
                                                                \
             return ERROR_INVALID_PARAM;                        \
                                                                \
@@ -153,13 +162,10 @@ uint8_t usart_init_state = 0;
         case SERIAL_PARITY_ODD:                                \
             break;                                             \
         default:                                               \
-            if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)            \
-            {                                                  \
-                KERNEL_LOG_ERROR("Invalid USART partity mode", \
-                                 (void*)&parity,               \
-                                 sizeof(parity),               \
-                                 ERROR_INVALID_PARAM);         \
-            }                                                  \
+            KERNEL_LOG_ERROR("Invalid USART partity mode",     \
+                             (void*)&parity,                   \
+                             sizeof(parity),                   \
+                             ERROR_INVALID_PARAM);             \
                                                                \
             return ERROR_INVALID_PARAM;                        \
                                                                \
@@ -185,13 +191,10 @@ uint8_t usart_init_state = 0;
         case SERIAL_CTRL_FLOW_CTS_RTS:                         \
             break;                                             \
         default:                                               \
-            if(KERNEL_LOG_LEVEL == ERROR_LOG_LEVEL)            \
-            {                                                  \
-                KERNEL_LOG_ERROR("Invalid USART control flow", \
-                                 (void*)&ctrlflow,             \
-                                 sizeof(ctrlflow),             \
-                                 ERROR_INVALID_PARAM);         \
-            }                                                  \
+            KERNEL_LOG_ERROR("Invalid USART control flow",     \
+                             (void*)&ctrlflow,                 \
+                             sizeof(ctrlflow),                 \
+                             ERROR_INVALID_PARAM);             \
                                                                \
             return ERROR_INVALID_PARAM;                        \
                                                                \
@@ -399,6 +402,47 @@ void bsp_usart_enable(const USART_IDENTIFIER_E usart_id)
     }
 }
 
+/**
+ * @brief USART2 interrupt handler.
+ *
+ * @details USART2 interrupt handler. Sends the next queued byte when the data
+ * register is empty. The transmit interrupt is disabled once the ring buffer
+ * is drained. A producer preempting the handler may enable it again before
+ * it is disabled, the ring buffer is checked again after disabling it.
+ *
+ * @param[in] int_number The interrupt identifier.
+ * @param[in] stack The interrupted stack.
+ * @param[in] cpu_state The interrupted CPU state.
+ */
+static void usart_tx_handler(const INTERRUPT_ID_T int_number,
+                             const uintptr_t stack,
+                             const uintptr_t cpu_state)
+{
+    uint8_t byte;
+
+    (void)int_number;
+    (void)stack;
+    (void)cpu_state;
+
+    if((*USART2_SR_REGISTER & USART_SR_TXE) == 0)
+    {
+        return;
+    }
+
+    if(spsc_ring_buffer_read(&usart_tx_ring, &byte, 1) == 1)
+    {
+        *USART2_DR_REGISTER = byte;
+    }
+    else
+    {
+        *USART2_CR1_REGISTER = *USART2_CR1_REGISTER & ~USART_CR1_TXEIE;
+        if(spsc_ring_buffer_get_used(&usart_tx_ring) != 0)
+        {
+            *USART2_CR1_REGISTER = *USART2_CR1_REGISTER | USART_CR1_TXEIE;
+        }
+    }
+}
+
 /*******************************************************************************
  * Public functions
  ******************************************************************************/
@@ -499,4 +543,144 @@ ERROR_CODE_E serial_write(const char* str, const size_t length)
     }
 
     return NO_ERROR;
-}
\ No newline at end of file
+}
+
+ERROR_CODE_E serial_enable_async(void)
+{
+    ERROR_CODE_E error;
+
+    if(usart_init_state == 0)
+    {
+        return ERROR_NEED_INIT;
+    }
+    if(usart_async_state != 0)
+    {
+        return ERROR_ALREADY_INIT;
+    }
+
+    error = spsc_ring_buffer_init(&usart_tx_ring, 
+                                  usart_tx_storage, 
+                                  sizeof(usart_tx_storage));
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    error = kernel_interrupt_register_handler(INT_EXT_FIRST_ID + 
+                                              USART2_IRQ_LINE,
+                                              usart_tx_handler);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+    error = cpu_interrupt_enable_line(USART2_IRQ_LINE);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    usart_async_state = 1;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E serial_write_async(const char* str, const size_t length)
+{
+    IO_VECTOR_T vector;
+
+    vector.base   = str;
+    vector.length = length;
+
+    return serial_writev_async(&vector, 1);
+}
+
+ERROR_CODE_E serial_writev_async(const IO_VECTOR_T* vector, 
+                                 const size_t count)
+{
+    uint32_t     int_state;
+    uint32_t     written;
+    size_t       length;
+    size_t       i;
+    ERROR_CODE_E error;
+
+    if(vector == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(usart_async_state == 0)
+    {
+        for(i = 0; i < count; ++i)
+        {
+            error = serial_write(vector[i].base, vector[i].length);
+            if(error != NO_ERROR)
+            {
+                return error;
+            }
+        }
+        return NO_ERROR;
+    }
+
+    length = 0;
+    for(i = 0; i < count; ++i)
+    {
+        length += vector[i].length;
+    }
+
+    /* Producers are serialized, the buffers are queued as a whole or dropped */
+    int_state = cpu_enter_critical();
+
+    if(length > usart_tx_ring.size - 
+                spsc_ring_buffer_get_used(&usart_tx_ring))
+    {
+        ++usart_tx_dropped;
+        cpu_exit_critical(int_state);
+        return ERROR_NO_MEMORY;
+    }
+
+    written = 0;
+    for(i = 0; i < count; ++i)
+    {
+        written += spsc_ring_buffer_write(&usart_tx_ring, 
+                                          vector[i].base, 
+                                          vector[i].length);
+    }
+    if(written != 0)
+    {
+        *USART2_CR1_REGISTER = *USART2_CR1_REGISTER | USART_CR1_TXEIE;
+    }
+
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+void serial_flush(void)
+{
+    uint8_t byte;
+
+    if(usart_async_state == 0)
+    {
+        return;
+    }
+
+    while(spsc_ring_buffer_read(&usart_tx_ring, &byte, 1) == 1)
+    {
+        /* Wait for serial line to be ready to transmit */
+        while((*USART2_SR_REGISTER & USART_SR_TXE) == 0);
+
+        *USART2_DR_REGISTER = byte;
+    }
+}
+
+ERROR_CODE_E serial_get_drop_count(uint32_t* count)
+{
+    if(count == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    *count = usart_tx_dropped;
+
+    return NO_ERROR;
+}
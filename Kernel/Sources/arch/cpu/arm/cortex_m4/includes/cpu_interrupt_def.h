@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * @file cpu_interrupt_def.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief ARM Cortex M4 interrupt vector definitions.
+ *
+ * @details ARM Cortex M4 interrupt vector definitions. This module contains the
+ * definitions used to relocate and manage the M4 interrupt vector table.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_INTERRUPT_ARM_CORTEX_M4_DEF_H__
+#define __CPU_CPU_INTERRUPT_ARM_CORTEX_M4_DEF_H__
+
+#include "stdint.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Vector Table Offset Register address */
+#define SCB_VTOR_ADDRESS  0xE000ED08
+#define SCB_VTOR_REGISTER ((volatile uint32_t*)SCB_VTOR_ADDRESS)
+
+/** @brief Number of system exception vectors, including the initial SP. */
+#define CPU_INTERRUPT_SYSTEM_VECTOR_COUNT 16
+
+/** @brief Number of external interrupt lines of the target. */
+#define CPU_INTERRUPT_EXT_LINE_COUNT 84
+
+/** @brief Total number of entries in the interrupt vector table. */
+#define CPU_INTERRUPT_VECTOR_COUNT \
+    (CPU_INTERRUPT_SYSTEM_VECTOR_COUNT + CPU_INTERRUPT_EXT_LINE_COUNT)
+
+/**
+ * @brief Vector table alignment, the table size rounded up to the next power
+ * of two as required by VTOR.
+ */
+#define CPU_INTERRUPT_VECTOR_ALIGN 512
+
+/** @brief First vector that can be replaced (NMI). */
+#define CPU_INTERRUPT_FIRST_VECTOR 2
+
+/** @brief NVIC Interrupt Set-Enable Registers base address */
+#define NVIC_ISER_ADDRESS  0xE000E100
+#define NVIC_ISER_REGISTER ((volatile uint32_t*)NVIC_ISER_ADDRESS)
+
+/** @brief NVIC Interrupt Clear-Enable Registers base address */
+#define NVIC_ICER_ADDRESS  0xE000E180
+#define NVIC_ICER_REGISTER ((volatile uint32_t*)NVIC_ICER_ADDRESS)
+
+/** @brief NVIC Interrupt Set-Pending Registers base address */
+#define NVIC_ISPR_ADDRESS  0xE000E200
+#define NVIC_ISPR_REGISTER ((volatile uint32_t*)NVIC_ISPR_ADDRESS)
+
+/** @brief NVIC Interrupt Clear-Pending Registers base address */
+#define NVIC_ICPR_ADDRESS  0xE000E280
+#define NVIC_ICPR_REGISTER ((volatile uint32_t*)NVIC_ICPR_ADDRESS)
+
+/** @brief NVIC Interrupt Active Bit Registers base address */
+#define NVIC_IABR_ADDRESS  0xE000E300
+#define NVIC_IABR_REGISTER ((volatile uint32_t*)NVIC_IABR_ADDRESS)
+
+/** @brief NVIC Interrupt Priority Registers base address, byte accessible */
+#define NVIC_IPR_ADDRESS  0xE000E400
+#define NVIC_IPR_REGISTER ((volatile uint8_t*)NVIC_IPR_ADDRESS)
+
+/** @brief Number of priority bits implemented by the target. */
+#define NVIC_PRIO_BITS 4
+
+/** @brief Number of priority levels available. */
+#define NVIC_PRIO_LEVELS (1 << NVIC_PRIO_BITS)
+
+/** @brief Priority bits are implemented in the high bits of each IPR byte. */
+#define NVIC_PRIO_SHIFT (8 - NVIC_PRIO_BITS)
+
+/** @brief Returns the index of the 32 bits NVIC register of a line. */
+#define NVIC_LINE_REG(line) ((line) >> 5)
+/** @brief Returns the bit of a line in its 32 bits NVIC register. */
+#define NVIC_LINE_BIT(line) (1UL << ((line) & 0x1F))
+
+#endif /* #ifndef __CPU_CPU_INTERRUPT_ARM_CORTEX_M4_DEF_H__ */
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * @file cpu_mpu_def.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief ARM Cortex M4 memory protection unit definitions.
+ *
+ * @details ARM Cortex M4 memory protection unit definitions. This module 
+ * contains the definitions used to control the M4 memory protection unit.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_MPU_ARM_CORTEX_M4_DEF_H__
+#define __CPU_CPU_MPU_ARM_CORTEX_M4_DEF_H__
+
+#include "stdint.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief MPU Type Register address */
+#define MPU_TYPE_ADDRESS  0xE000ED90
+#define MPU_TYPE_REGISTER ((volatile uint32_t*)MPU_TYPE_ADDRESS)
+
+/** @brief MPU Control Register address */
+#define MPU_CTRL_ADDRESS  0xE000ED94
+#define MPU_CTRL_REGISTER ((volatile uint32_t*)MPU_CTRL_ADDRESS)
+
+/** @brief MPU Region Number Register address */
+#define MPU_RNR_ADDRESS  0xE000ED98
+#define MPU_RNR_REGISTER ((volatile uint32_t*)MPU_RNR_ADDRESS)
+
+/** @brief MPU Region Base Address Register address */
+#define MPU_RBAR_ADDRESS  0xE000ED9C
+#define MPU_RBAR_REGISTER ((volatile uint32_t*)MPU_RBAR_ADDRESS)
+
+/** @brief MPU Region Attribute and Size Register address */
+#define MPU_RASR_ADDRESS  0xE000EDA0
+#define MPU_RASR_REGISTER ((volatile uint32_t*)MPU_RASR_ADDRESS)
+
+/** @brief System Handler Control and State Register address */
+#define SCB_SHCSR_ADDRESS  0xE000ED24
+#define SCB_SHCSR_REGISTER ((volatile uint32_t*)SCB_SHCSR_ADDRESS)
+
+/** @brief MemManage Fault Status Register address */
+#define SCB_MMFSR_ADDRESS  0xE000ED28
+#define SCB_MMFSR_REGISTER ((volatile uint8_t*)SCB_MMFSR_ADDRESS)
+
+/** @brief MemManage Fault Address Register address */
+#define SCB_MMFAR_ADDRESS  0xE000ED34
+#define SCB_MMFAR_REGISTER ((volatile uint32_t*)SCB_MMFAR_ADDRESS)
+
+/** @brief MPU_TYPE DREGION field shift and mask. */
+#define MPU_TYPE_DREGION_SHIFT 8
+#define MPU_TYPE_DREGION_MASK  0xFF
+
+/** @brief MPU_CTRL ENABLE flag, enables the MPU. */
+#define MPU_CTRL_ENABLE     0x00000001
+/** @brief MPU_CTRL PRIVDEFENA flag, privileged default memory map. */
+#define MPU_CTRL_PRIVDEFENA 0x00000004
+
+/** @brief MPU_RBAR VALID flag, the region number is taken from RBAR. */
+#define MPU_RBAR_VALID 0x00000010
+/** @brief MPU_RBAR REGION field mask. */
+#define MPU_RBAR_REGION_MASK 0x0000000F
+
+/** @brief MPU_RASR ENABLE flag, enables the region. */
+#define MPU_RASR_ENABLE    0x00000001
+/** @brief MPU_RASR SIZE field shift, the region size is 2^(SIZE + 1). */
+#define MPU_RASR_SIZE_SHIFT 1
+/** @brief MPU_RASR AP field: no access for privileged and unprivileged. */
+#define MPU_RASR_AP_NONE   0x00000000
+/** @brief MPU_RASR AP field: read/write for privileged and unprivileged. */
+#define MPU_RASR_AP_RW     0x03000000
+/** @brief MPU_RASR AP field: read only for privileged and unprivileged. */
+#define MPU_RASR_AP_RO     0x06000000
+/** @brief MPU_RASR S flag, shareable memory. */
+#define MPU_RASR_S         0x00040000
+/** @brief MPU_RASR C flag, cacheable memory. */
+#define MPU_RASR_C         0x00020000
+/** @brief MPU_RASR XN flag, instruction fetches are forbidden. */
+#define MPU_RASR_XN        0x10000000
+
+/** @brief SCB_SHCSR MEMFAULTENA flag, enables the MemManage exception. */
+#define SCB_SHCSR_MEMFAULTENA 0x00010000
+
+/** @brief SCB_MMFSR MMARVALID flag, MMFAR holds the faulting address. */
+#define SCB_MMFSR_MMARVALID 0x80
+/** @brief SCB_MMFSR MSTKERR flag, fault on exception entry stacking. */
+#define SCB_MMFSR_MSTKERR   0x10
+
+/** @brief Size in bytes of a stack guard region. */
+#define MPU_STACK_GUARD_SIZE 32
+/** @brief MPU_RASR SIZE field value of a stack guard region (2^5). */
+#define MPU_STACK_GUARD_RASR_SIZE 4
+
+/** @brief MPU region used by the unprivileged flash access. */
+#define MPU_FLASH_REGION      0
+/** @brief MPU region used by the unprivileged data. */
+#define MPU_USER_DATA_REGION  1
+/** @brief MPU region used by the unprivileged task stack. */
+#define MPU_TASK_STACK_REGION 5
+
+/** @brief Flash base address. */
+#define MPU_FLASH_BASE      0x08000000
+/** @brief Flash region MPU_RASR SIZE field value (2^19, 512KB). */
+#define MPU_FLASH_RASR_SIZE 18
+
+/** @brief Minimal size in bytes of a MPU region. */
+#define MPU_REGION_MIN_SIZE 32
+
+/** @brief MPU region used by the task stack guard, highest priority. */
+#define MPU_TASK_GUARD_REGION 7
+/** @brief MPU region used by the main stack guard. */
+#define MPU_MAIN_GUARD_REGION 6
+
+#endif /* #ifndef __CPU_CPU_MPU_ARM_CORTEX_M4_DEF_H__ */
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * @file cpu_profile_def.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief ARM Cortex M4 data watchpoint and trace unit definitions.
+ *
+ * @details ARM Cortex M4 data watchpoint and trace unit definitions. This 
+ * module contains the definitions used to control the M4 cycle counter.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_PROFILE_ARM_CORTEX_M4_DEF_H__
+#define __CPU_CPU_PROFILE_ARM_CORTEX_M4_DEF_H__
+
+#include "stdint.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Debug Exception and Monitor Control Register address */
+#define DEMCR_ADDRESS  0xE000EDFC
+#define DEMCR_REGISTER ((volatile uint32_t*)DEMCR_ADDRESS)
+
+/** @brief DWT Control Register address */
+#define DWT_CTRL_ADDRESS  0xE0001000
+#define DWT_CTRL_REGISTER ((volatile uint32_t*)DWT_CTRL_ADDRESS)
+
+/** @brief DWT Cycle Count Register address */
+#define DWT_CYCCNT_ADDRESS  0xE0001004
+#define DWT_CYCCNT_REGISTER ((volatile uint32_t*)DWT_CYCCNT_ADDRESS)
+
+/** @brief DEMCR TRCENA flag, enables the DWT and ITM units. */
+#define DEMCR_TRCENA 0x01000000
+
+/** @brief DWT_CTRL NOCYCCNT flag, set when the cycle counter is absent. */
+#define DWT_CTRL_NOCYCCNT 0x02000000
+/** @brief DWT_CTRL CYCCNTENA flag, enables the cycle counter. */
+#define DWT_CTRL_CYCCNTENA 0x00000001
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+#endif /* #ifndef __CPU_CPU_PROFILE_ARM_CORTEX_M4_DEF_H__ */
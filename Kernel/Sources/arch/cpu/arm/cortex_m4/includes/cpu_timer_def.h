@@ -47,10 +47,19 @@
 #define STK_CTRL_TICKINT      0x00000002
 /** @brief STK_CTRL ENABLE flag, enables the timer. */
 #define STK_CTRL_EN           0x00000001
+/** @brief STK_CTRL COUNTFLAG flag, set when the timer reached 0. */
+#define STK_CTRL_COUNTFLAG    0x00010000
 
 /** @brief Maximal load value for the system tick. */
 #define STK_LOAD_MAX_VALUE 0x00FFFFFF
 
+/** @brief Interrupt Control and State Register address */
+#define SCB_ICSR_ADDRESS  0xE000ED04
+#define SCB_ICSR_REGISTER ((volatile uint32_t*)SCB_ICSR_ADDRESS)
+
+/** @brief SCB_ICSR PENDSTSET flag, sets the system timer interrupt pending. */
+#define SCB_ICSR_PENDSTSET 0x04000000
+
 
 /*******************************************************************************
  * STRUCTURES
@@ -0,0 +1,37 @@
+/*******************************************************************************
+ * @file panic_def.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief ARM Cortex M4 panic definitions.
+ *
+ * @details ARM Cortex M4 panic definitions. This module contains the fault 
+ * status registers saved in the panic record.
+ ******************************************************************************/
+
+#ifndef __CPU_PANIC_ARM_CORTEX_M4_DEF_H__
+#define __CPU_PANIC_ARM_CORTEX_M4_DEF_H__
+
+#include "stdint.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Configurable Fault Status Register address */
+#define SCB_CFSR_ADDRESS  0xE000ED28
+#define SCB_CFSR_REGISTER ((volatile uint32_t*)SCB_CFSR_ADDRESS)
+
+/** @brief HardFault Status Register address */
+#define SCB_HFSR_ADDRESS  0xE000ED2C
+#define SCB_HFSR_REGISTER ((volatile uint32_t*)SCB_HFSR_ADDRESS)
+
+/** @brief BusFault Address Register address */
+#define SCB_BFAR_ADDRESS  0xE000ED38
+#define SCB_BFAR_REGISTER ((volatile uint32_t*)SCB_BFAR_ADDRESS)
+
+#endif /* #ifndef __CPU_PANIC_ARM_CORTEX_M4_DEF_H__ */
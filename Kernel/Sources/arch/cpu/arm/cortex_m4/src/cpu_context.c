@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * @file cpu_context.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Cortex M4 execution context management.
+ *
+ * @details Cortex M4 execution context management. This module contains the
+ * routines used to create the execution contexts switched by the kernel.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "cpu_api.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Initial xPSR value, only the Thumb state bit is set. */
+#define CONTEXT_INIT_XPSR 0x01000000
+
+/** @brief Initial EXC_RETURN value: thread mode, PSP, no FPU frame. */
+#define CONTEXT_INIT_EXC_RETURN 0xFFFFFFFD
+
+/** @brief Number of words in the hardware saved frame. */
+#define CONTEXT_HW_FRAME_SIZE 8
+
+/** @brief Number of words in the software saved frame (r4-r11, EXC_RETURN) */
+#define CONTEXT_SW_FRAME_SIZE 9
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+uintptr_t cpu_init_context(const uintptr_t stack_top,
+                           void (*entry)(void*),
+                           void* args,
+                           void (*exit_point)(void))
+{
+    uint32_t* frame;
+    uint32_t  i;
+
+    /* The stack must be 8 bytes aligned on exception entry */
+    frame = (uint32_t*)(stack_top & ~(uintptr_t)0x7);
+
+    /* Hardware frame: r0, r1, r2, r3, r12, lr, pc, xPSR */
+    frame -= CONTEXT_HW_FRAME_SIZE;
+    frame[0] = (uint32_t)args;
+    frame[1] = 0;
+    frame[2] = 0;
+    frame[3] = 0;
+    frame[4] = 0;
+    frame[5] = (uint32_t)exit_point;
+    frame[6] = (uint32_t)entry & ~(uint32_t)0x1;
+    frame[7] = CONTEXT_INIT_XPSR;
+
+    /* Software frame: r4-r11, EXC_RETURN */
+    frame -= CONTEXT_SW_FRAME_SIZE;
+    for(i = 0; i < CONTEXT_SW_FRAME_SIZE - 1; ++i)
+    {
+        frame[i] = 0;
+    }
+    frame[CONTEXT_SW_FRAME_SIZE - 1] = CONTEXT_INIT_EXC_RETURN;
+
+    return (uintptr_t)frame;
+}
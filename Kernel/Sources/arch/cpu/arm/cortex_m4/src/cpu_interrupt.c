@@ -0,0 +1,311 @@
+/*******************************************************************************
+ * @file cpu_interrupt.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief CPU interrupt vector module implementation.
+ *
+ * @details CPU interrupt vector module implementation. The boot vector table
+ * located in flash is copied to RAM and the CPU is relocated to the copy
+ * through VTOR. Interrupt service routines are then installed directly in the
+ * RAM table, the CPU reaches them with the hardware latency only. The
+ * external interrupt lines are controlled through the NVIC registers.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CPU
+
+#include "error_types.h"
+#include "stdint.h"
+#include "stddef.h"
+#include "cpu_api.h"
+#include "cpu_interrupt.h"
+#include "cpu_interrupt_def.h"
+#include "config.h"
+#include "logger.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+#if CONFIG_MAX_INTERRUPT_LINES > CPU_INTERRUPT_EXT_LINE_COUNT
+#error CONFIG_MAX_INTERRUPT_LINES exceeds the CPU external interrupt lines
+#endif
+
+#if CONFIG_KERNEL_INT_PRIORITY_CEILING < 1 || \
+    CONFIG_KERNEL_INT_PRIORITY_CEILING >= NVIC_PRIO_LEVELS
+#error CONFIG_KERNEL_INT_PRIORITY_CEILING must be in [1, NVIC_PRIO_LEVELS[
+#endif
+
+/** @brief Boot vector table, defined in boot.S */
+extern const uint32_t __rst_vector[CPU_INTERRUPT_VECTOR_COUNT];
+
+/** @brief RAM vector table used by the CPU once relocated. */
+static volatile uint32_t ram_vector[CPU_INTERRUPT_VECTOR_COUNT]
+    __attribute__((aligned(CPU_INTERRUPT_VECTOR_ALIGN)));
+
+/** @brief Stores the vector table relocation state. */
+static uint8_t vector_relocated = 0;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Checks an external interrupt line number.
+ * 
+ * @details Checks that the external interrupt line number is managed by the
+ * kernel.
+ * 
+ * @param[in] line The external interrupt line to check.
+ * 
+ * @return NO_ERROR is returned if the line is valid, ERROR_INVALID_PARAM 
+ * otherwise.
+ */
+static ERROR_CODE_E cpu_interrupt_check_line(const uint32_t line)
+{
+    if(line >= CONFIG_MAX_INTERRUPT_LINES)
+    {
+        KERNEL_LOG_ERROR("Interrupt line out of bound", 
+                         (void*)&line, 
+                         sizeof(line),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    return NO_ERROR;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E cpu_interrupt_init_vector(void)
+{
+    uint32_t int_state;
+    uint32_t i;
+
+    if(vector_relocated != 0)
+    {
+        return ERROR_ALREADY_INIT;
+    }
+
+    int_state = cpu_disable_interrupts();
+
+    for(i = 0; i < CPU_INTERRUPT_VECTOR_COUNT; ++i)
+    {
+        ram_vector[i] = __rst_vector[i];
+    }
+
+    cpu_mem_barrier();
+    *SCB_VTOR_REGISTER = (uint32_t)ram_vector;
+    cpu_mem_barrier();
+
+    vector_relocated = 1;
+
+    cpu_restore_interrupts(int_state);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_set_vector(const uint32_t vector_id, 
+                                      void (*isr)(void))
+{
+    if(vector_relocated == 0)
+    {
+        return ERROR_NEED_INIT;
+    }
+    if(isr == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(vector_id < CPU_INTERRUPT_FIRST_VECTOR || 
+       vector_id >= CPU_INTERRUPT_VECTOR_COUNT)
+    {
+        KERNEL_LOG_ERROR("Interrupt vector out of bound", 
+                         (void*)&vector_id, 
+                         sizeof(vector_id),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    /* Keep the Thumb bit set */
+    ram_vector[vector_id] = (uint32_t)isr | 0x1;
+    cpu_mem_barrier();
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_restore_vector(const uint32_t vector_id)
+{
+    if(vector_relocated == 0)
+    {
+        return ERROR_NEED_INIT;
+    }
+    if(vector_id < CPU_INTERRUPT_FIRST_VECTOR || 
+       vector_id >= CPU_INTERRUPT_VECTOR_COUNT)
+    {
+        KERNEL_LOG_ERROR("Interrupt vector out of bound", 
+                         (void*)&vector_id, 
+                         sizeof(vector_id),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    ram_vector[vector_id] = __rst_vector[vector_id];
+    cpu_mem_barrier();
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_enable_line(const uint32_t line)
+{
+    ERROR_CODE_E error;
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    NVIC_ISER_REGISTER[NVIC_LINE_REG(line)] = NVIC_LINE_BIT(line);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_disable_line(const uint32_t line)
+{
+    ERROR_CODE_E error;
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    /* Ensure the line is disabled when returning */
+    NVIC_ICER_REGISTER[NVIC_LINE_REG(line)] = NVIC_LINE_BIT(line);
+    cpu_mem_barrier();
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_set_priority(const uint32_t line, 
+                                        const uint32_t priority)
+{
+    ERROR_CODE_E error;
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+    if(priority >= NVIC_PRIO_LEVELS)
+    {
+        KERNEL_LOG_ERROR("Interrupt priority out of bound", 
+                         (void*)&priority, 
+                         sizeof(priority),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    NVIC_IPR_REGISTER[line] = (uint8_t)(priority << NVIC_PRIO_SHIFT);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_get_priority(const uint32_t line, 
+                                        uint32_t* priority)
+{
+    ERROR_CODE_E error;
+
+    if(priority == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    *priority = (uint32_t)NVIC_IPR_REGISTER[line] >> NVIC_PRIO_SHIFT;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_set_pending(const uint32_t line)
+{
+    ERROR_CODE_E error;
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    NVIC_ISPR_REGISTER[NVIC_LINE_REG(line)] = NVIC_LINE_BIT(line);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_clear_pending(const uint32_t line)
+{
+    ERROR_CODE_E error;
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    NVIC_ICPR_REGISTER[NVIC_LINE_REG(line)] = NVIC_LINE_BIT(line);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_is_pending(const uint32_t line, uint8_t* pending)
+{
+    ERROR_CODE_E error;
+
+    if(pending == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    *pending = 
+        ((NVIC_ISPR_REGISTER[NVIC_LINE_REG(line)] & NVIC_LINE_BIT(line)) != 0);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_interrupt_is_active(const uint32_t line, uint8_t* active)
+{
+    ERROR_CODE_E error;
+
+    if(active == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    error = cpu_interrupt_check_line(line);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    *active = 
+        ((NVIC_IABR_REGISTER[NVIC_LINE_REG(line)] & NVIC_LINE_BIT(line)) != 0);
+
+    return NO_ERROR;
+}
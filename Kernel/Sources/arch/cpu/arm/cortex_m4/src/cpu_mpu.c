@@ -0,0 +1,261 @@
+/*******************************************************************************
+ * @file cpu_mpu.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief CPU memory protection module implementation.
+ *
+ * @details CPU memory protection module implementation. The MPU is enabled 
+ * with the privileged default memory map as background region. Two no access 
+ * regions are used as stack guards: one at the bottom of the main stack and
+ * one moved to the bottom of the elected task stack on each context switch.
+ * Unprivileged code can read the flash and access the user data region and 
+ * its own stack, the stack region is also moved on each context switch.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CPU
+
+#include "error_types.h"
+#include "stdint.h"
+#include "stddef.h"
+#include "cpu_api.h"
+#include "cpu_mpu.h"
+#include "cpu_mpu_def.h"
+#include "logger.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Main stack lowest address, defined by the linker script. */
+extern uint8_t _main_stack_bottom;
+
+/** @brief User data region start address, defined by the linker script. */
+extern uint8_t _start_user_data;
+/** @brief User data region size, defined by the linker script. */
+extern uint8_t _user_data_size;
+
+/** @brief Guard region attributes: no access, no execution, 32 bytes. */
+#define MPU_STACK_GUARD_RASR (MPU_RASR_XN | MPU_RASR_AP_NONE |            \
+                              (MPU_STACK_GUARD_RASR_SIZE <<               \
+                               MPU_RASR_SIZE_SHIFT) |                     \
+                              MPU_RASR_ENABLE)
+
+/** @brief Flash region attributes: read only, 512KB. */
+#define MPU_FLASH_RASR (MPU_RASR_AP_RO | MPU_RASR_C |                      \
+                        (MPU_FLASH_RASR_SIZE << MPU_RASR_SIZE_SHIFT) |     \
+                        MPU_RASR_ENABLE)
+
+/** @brief SRAM regions attributes: read/write, no execution, size excluded. */
+#define MPU_SRAM_RW_RASR (MPU_RASR_XN | MPU_RASR_AP_RW | MPU_RASR_S |       \
+                          MPU_RASR_C | MPU_RASR_ENABLE)
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Aligns an address on the guard region size.
+ *
+ * @param[in] addr The address to align.
+ *
+ * @return The address rounded up to the next guard region boundary.
+ */
+static uintptr_t cpu_mpu_align_guard(const uintptr_t addr)
+{
+    return (addr + MPU_STACK_GUARD_SIZE - 1) & 
+           ~(uintptr_t)(MPU_STACK_GUARD_SIZE - 1);
+}
+
+/**
+ * @brief Computes the MPU_RASR SIZE field of a region.
+ *
+ * @param[in] base The region base address.
+ * @param[in] size The region size in bytes.
+ * @param[out] size_field The pointer to store the field value.
+ *
+ * @return NO_ERROR is returned if the size is a power of two of at least 32
+ * bytes and the base is aligned on the size. ERROR_INVALID_PARAM is returned 
+ * otherwise.
+ */
+static ERROR_CODE_E cpu_mpu_get_size_field(const uintptr_t base,
+                                           const size_t size,
+                                           uint32_t* size_field)
+{
+    if(size < MPU_REGION_MIN_SIZE ||
+       (size & (size - 1)) != 0 ||
+       (base & (size - 1)) != 0)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+
+    *size_field = ((uint32_t)__builtin_ctz(size) - 1) << MPU_RASR_SIZE_SHIFT;
+
+    return NO_ERROR;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E cpu_mpu_init(void)
+{
+    uint32_t     regions;
+    uint32_t     int_state;
+    uint32_t     user_size;
+    ERROR_CODE_E error;
+
+    /* Check that the MPU is present */
+    regions = (*MPU_TYPE_REGISTER >> MPU_TYPE_DREGION_SHIFT) & 
+              MPU_TYPE_DREGION_MASK;
+    if(regions <= MPU_TASK_GUARD_REGION)
+    {
+        KERNEL_LOG_ERROR("MPU not available", 
+                         (void*)&regions, 
+                         sizeof(regions),
+                         ERROR_NOT_AVAILABLE);
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    error = cpu_mpu_get_size_field((uintptr_t)&_start_user_data,
+                                   (size_t)&_user_data_size,
+                                   &user_size);
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Invalid user data region", 
+                         (void*)&_start_user_data, 
+                         sizeof(uintptr_t),
+                         error);
+        return error;
+    }
+
+    int_state = cpu_disable_interrupts();
+
+    *MPU_CTRL_REGISTER = 0;
+    cpu_mem_barrier();
+
+    /* Unprivileged flash and data access */
+    *MPU_RNR_REGISTER  = MPU_FLASH_REGION;
+    *MPU_RBAR_REGISTER = MPU_FLASH_BASE;
+    *MPU_RASR_REGISTER = MPU_FLASH_RASR;
+
+    *MPU_RNR_REGISTER  = MPU_USER_DATA_REGION;
+    *MPU_RBAR_REGISTER = (uintptr_t)&_start_user_data;
+    *MPU_RASR_REGISTER = MPU_SRAM_RW_RASR | user_size;
+
+    /* Task stack region, set on each context switch */
+    *MPU_RNR_REGISTER  = MPU_TASK_STACK_REGION;
+    *MPU_RASR_REGISTER = 0;
+
+    /* Main stack guard */
+    *MPU_RNR_REGISTER  = MPU_MAIN_GUARD_REGION;
+    *MPU_RBAR_REGISTER = cpu_mpu_align_guard((uintptr_t)&_main_stack_bottom);
+    *MPU_RASR_REGISTER = MPU_STACK_GUARD_RASR;
+
+    /* Task stack guard, its base is set on each context switch */
+    *MPU_RNR_REGISTER  = MPU_TASK_GUARD_REGION;
+    *MPU_RBAR_REGISTER = cpu_mpu_align_guard((uintptr_t)&_main_stack_bottom);
+    *MPU_RASR_REGISTER = MPU_STACK_GUARD_RASR;
+
+    *SCB_SHCSR_REGISTER = *SCB_SHCSR_REGISTER | SCB_SHCSR_MEMFAULTENA;
+    *MPU_CTRL_REGISTER  = MPU_CTRL_PRIVDEFENA | MPU_CTRL_ENABLE;
+    cpu_mem_barrier();
+
+    cpu_restore_interrupts(int_state);
+
+    KERNEL_LOG_INFO("MPU initialized", NULL, 0, NO_ERROR);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_mpu_get_stack_guard(const uintptr_t stack_base, 
+                                     uint32_t* guard)
+{
+    if(guard == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    *guard = (uint32_t)cpu_mpu_align_guard(stack_base) | 
+             MPU_RBAR_VALID | 
+             MPU_TASK_GUARD_REGION;
+
+    return NO_ERROR;
+}
+
+void cpu_mpu_set_stack_guard(const uint32_t guard)
+{
+    *MPU_RBAR_REGISTER = guard;
+    cpu_mem_barrier();
+}
+
+ERROR_CODE_E cpu_mpu_get_stack_region(const uintptr_t stack_base,
+                                      const size_t stack_size,
+                                      const uint8_t unprivileged,
+                                      CPU_MPU_REGION_T* region)
+{
+    uint32_t     size_field;
+    ERROR_CODE_E error;
+
+    if(region == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    region->base = MPU_RBAR_VALID | MPU_TASK_STACK_REGION;
+
+    /* Privileged tasks use the default memory map */
+    if(unprivileged == 0)
+    {
+        region->attributes = 0;
+        return NO_ERROR;
+    }
+
+    error = cpu_mpu_get_size_field(stack_base, stack_size, &size_field);
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Invalid unprivileged stack", 
+                         (void*)&stack_base, 
+                         sizeof(stack_base),
+                         error);
+        return error;
+    }
+
+    region->base      |= (uint32_t)stack_base;
+    region->attributes = MPU_SRAM_RW_RASR | size_field;
+
+    return NO_ERROR;
+}
+
+void cpu_mpu_set_stack_region(const CPU_MPU_REGION_T* region)
+{
+    *MPU_RBAR_REGISTER = region->base;
+    *MPU_RASR_REGISTER = region->attributes;
+    cpu_mem_barrier();
+}
+
+ERROR_CODE_E cpu_mpu_get_fault(uintptr_t* addr, uint8_t* on_stacking)
+{
+    uint8_t status;
+
+    if(addr == NULL || on_stacking == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    status       = *SCB_MMFSR_REGISTER;
+    *on_stacking = ((status & SCB_MMFSR_MSTKERR) != 0);
+
+    if((status & SCB_MMFSR_MMARVALID) == 0)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    *addr = *SCB_MMFAR_REGISTER;
+
+    return NO_ERROR;
+}
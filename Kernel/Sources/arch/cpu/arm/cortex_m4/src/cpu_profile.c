@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * @file cpu_profile.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief CPU cycle profiling module implementation.
+ *
+ * @details CPU cycle profiling module implementation. The measurements use 
+ * the DWT cycle counter, enabled through the debug monitor control register.
+ * The cycle counter wraps around, measurements are computed modulo 2^32 and 
+ * must be shorter than 2^32 cycles.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CPU
+
+#include "error_types.h"
+#include "stdint.h"
+#include "stddef.h"
+#include "cpu_api.h"
+#include "cpu_profile.h"
+#include "cpu_profile_def.h"
+#include "logger.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Registered probes list. */
+static CPU_PROFILE_PROBE_T* profile_probes = NULL;
+
+/** @brief Cycles spent by an empty measurement. */
+static uint32_t profile_overhead = 0;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Divides a 64 bits value by a 32 bits value.
+ *
+ * @details Divides a 64 bits value by a 32 bits value with a bitwise long 
+ * division, the kernel does not link the compiler's 64 bits division.
+ *
+ * @param[in] dividend The value to divide.
+ * @param[in] divisor The divisor, not null.
+ *
+ * @return The quotient, saturated to 32 bits, is returned.
+ */
+static uint32_t cpu_profile_div(const uint64_t dividend, const uint32_t divisor)
+{
+    uint64_t remain;
+    uint64_t quotient;
+    int32_t  i;
+
+    remain   = 0;
+    quotient = 0;
+    for(i = 63; i >= 0; --i)
+    {
+        remain   = (remain << 1) | ((dividend >> i) & 1);
+        quotient <<= 1;
+        if(remain >= divisor)
+        {
+            remain   -= divisor;
+            quotient |= 1;
+        }
+    }
+
+    return (quotient > UINT32_MAX) ? UINT32_MAX : (uint32_t)quotient;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E cpu_profile_init(void)
+{
+    CPU_PROFILE_PROBE_T probe;
+
+    *DEMCR_REGISTER = *DEMCR_REGISTER | DEMCR_TRCENA;
+    if((*DWT_CTRL_REGISTER & DWT_CTRL_NOCYCCNT) != 0)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    *DWT_CYCCNT_REGISTER = 0;
+    *DWT_CTRL_REGISTER   = *DWT_CTRL_REGISTER | DWT_CTRL_CYCCNTENA;
+
+    /* Calibrate the measurement overhead on an empty measurement */
+    profile_overhead = 0;
+    probe.min        = UINT32_MAX;
+    probe.max        = 0;
+    probe.count      = 0;
+    probe.total      = 0;
+    cpu_profile_begin(&probe);
+    cpu_profile_end(&probe);
+    profile_overhead = probe.min;
+
+    return NO_ERROR;
+}
+
+uint32_t cpu_profile_get_cycles(void)
+{
+    return *DWT_CYCCNT_REGISTER;
+}
+
+ERROR_CODE_E cpu_profile_probe_init(CPU_PROFILE_PROBE_T* probe, 
+                                    const char* name)
+{
+    uint32_t int_state;
+
+    if(probe == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    probe->name  = name;
+    probe->start = 0;
+    probe->count = 0;
+    probe->min   = UINT32_MAX;
+    probe->max   = 0;
+    probe->total = 0;
+
+    int_state = cpu_enter_critical();
+    probe->next    = profile_probes;
+    profile_probes = probe;
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+void cpu_profile_begin(CPU_PROFILE_PROBE_T* probe)
+{
+    probe->start = *DWT_CYCCNT_REGISTER;
+}
+
+void cpu_profile_end(CPU_PROFILE_PROBE_T* probe)
+{
+    uint32_t cycles;
+
+    cycles = *DWT_CYCCNT_REGISTER - probe->start;
+    cycles = (cycles > profile_overhead) ? cycles - profile_overhead : 0;
+
+    ++probe->count;
+    probe->total += cycles;
+    if(cycles < probe->min)
+    {
+        probe->min = cycles;
+    }
+    if(cycles > probe->max)
+    {
+        probe->max = cycles;
+    }
+}
+
+ERROR_CODE_E cpu_profile_reset(CPU_PROFILE_PROBE_T* probe)
+{
+    if(probe == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    probe->count = 0;
+    probe->min   = UINT32_MAX;
+    probe->max   = 0;
+    probe->total = 0;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_profile_get_stats(const CPU_PROFILE_PROBE_T* probe,
+                                   CPU_PROFILE_STATS_T* stats)
+{
+    if(probe == NULL || stats == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    stats->count = probe->count;
+    if(probe->count == 0)
+    {
+        stats->min  = 0;
+        stats->max  = 0;
+        stats->mean = 0;
+    }
+    else
+    {
+        stats->min  = probe->min;
+        stats->max  = probe->max;
+        stats->mean = cpu_profile_div(probe->total, probe->count);
+    }
+
+    return NO_ERROR;
+}
+
+void cpu_profile_dump_all(void)
+{
+    CPU_PROFILE_PROBE_T* probe;
+    CPU_PROFILE_STATS_T  stats;
+    uint32_t             record[5];
+
+    for(probe = profile_probes; probe != NULL; probe = probe->next)
+    {
+        if(cpu_profile_get_stats(probe, &stats) == NO_ERROR)
+        {
+            /* The probe's name address is resolved by the log decoder */
+            record[0] = (uint32_t)(uintptr_t)probe->name;
+            record[1] = stats.count;
+            record[2] = stats.min;
+            record[3] = stats.max;
+            record[4] = stats.mean;
+            KERNEL_LOG_INFO("Profile probe", record, sizeof(record), NO_ERROR);
+        }
+    }
+}
@@ -12,8 +12,16 @@
  * @details CPU timers module definitions. This module contains the routines 
  * used by the kernel to manage the CPU timers. On architectures that do not
  * propose CPU timers, those functions should return an error.
+ *
+ * The monotonic clock accumulates the system timer periods in a 64 bits cycle
+ * count. Each reload sets the COUNTFLAG bit, which is cleared when read: the
+ * first reader of the flag, the tick handler or a clock reader, accounts the
+ * period so that it is counted exactly once. All the accesses to the control 
+ * register go through the accounting routine.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CPU_TIMER
+
 #include "error_types.h"
 #include "stdint.h"
 #include "stddef.h"
@@ -21,6 +29,7 @@
 #include "cpu_timer_def.h"
 #include "clocks.h"
 #include "logger.h"
+#include "cpu_api.h"
 
 /*******************************************************************************
  * Private data
@@ -29,29 +38,109 @@
 /** @brief Stores the currently used tick frequency of the CPU timer. */
 static uint32_t tick_freq = 0;
 
+/** @brief Stores the number of timer cycles in one tick period. */
+static uint32_t tick_cycles = 0;
+
+/** @brief Cycle count at the start of the current timer period. */
+static uint64_t clock_base = 0;
+
+/** @brief Load value of the current timer period. */
+static uint32_t clock_period_load = 0;
+
+/** @brief Integer part of the nanoseconds per cycle. */
+static uint32_t clock_ns_int = 0;
+
+/** @brief Fractional part of the nanoseconds per cycle, in 1/2^32. */
+static uint32_t clock_ns_frac = 0;
+
 /*******************************************************************************
  * Private functions
  ******************************************************************************/
 
+/**
+ * @brief Reads the timer control register and accounts the timer reload.
+ *
+ * @details Reads the timer control register. If the timer reloaded since the
+ * last read, the ended period is added to the clock base. This must be called
+ * with interrupts disabled.
+ *
+ * @return The control register value is returned.
+ */
+static uint32_t cpu_timer_read_ctrl(void)
+{
+    uint32_t ctrl;
+
+    ctrl = *STK_CTRL_REGISTER;
+    if((ctrl & STK_CTRL_COUNTFLAG) != 0)
+    {
+        clock_base       += (uint64_t)clock_period_load + 1;
+        clock_period_load = *STK_LOAD_REGISTER;
+    }
+
+    return ctrl;
+}
+
+/**
+ * @brief Restarts the timer on a new load value.
+ *
+ * @details Adds the cycles consumed in the current period to the clock base,
+ * then restarts the timer from the new load value. The timer must be stopped
+ * and this must be called with interrupts disabled.
+ *
+ * @param[in] load The load value of the new period.
+ */
+static void cpu_timer_restart(const uint32_t load)
+{
+    clock_base       += clock_period_load - *STK_VAL_REGISTER;
+    clock_period_load = load;
+
+    *STK_LOAD_REGISTER = load;
+    *STK_VAL_REGISTER  = 0;
+    *STK_CTRL_REGISTER = (cpu_timer_read_ctrl() & ~STK_CTRL_COUNTFLAG) | 
+                         STK_CTRL_EN;
+}
+
 /*******************************************************************************
  * Public functions
  ******************************************************************************/
 
 ERROR_CODE_E cpu_timer_enable(const uint8_t int_enable)
 {
+    uint32_t int_state;
+    uint32_t ctrl;
+
+    int_state = cpu_disable_interrupts();
+
+    /* Start the clock on a full period */
+    ctrl = cpu_timer_read_ctrl();
+    if((ctrl & STK_CTRL_EN) == 0)
+    {
+        *STK_VAL_REGISTER = 0;
+        clock_period_load = *STK_LOAD_REGISTER;
+    }
+
     /* Sets the clock source selection as processor clock and enable timer */
-    *STK_CTRL_REGISTER = *STK_CTRL_REGISTER  | 
-                         STK_CTRL_CLKSRC_AHB | 
-                         STK_CTRL_EN         | 
+    *STK_CTRL_REGISTER = (ctrl & ~STK_CTRL_COUNTFLAG) | 
+                         STK_CTRL_CLKSRC_AHB            | 
+                         STK_CTRL_EN                    | 
                          ((int_enable != 0) ? STK_CTRL_TICKINT : 0);
 
+    cpu_restore_interrupts(int_state);
+
     return NO_ERROR;
 }
 
 ERROR_CODE_E cpu_timer_disable(void)
 {
+    uint32_t int_state;
+
+    int_state = cpu_disable_interrupts();
+
     /* Disables the interrupts and timer */
-    *STK_CTRL_REGISTER = *STK_CTRL_REGISTER & ~(STK_CTRL_EN | STK_CTRL_TICKINT);
+    *STK_CTRL_REGISTER = cpu_timer_read_ctrl() & 
+                         ~(STK_CTRL_EN | STK_CTRL_TICKINT | STK_CTRL_COUNTFLAG);
+
+    cpu_restore_interrupts(int_state);
 
     return NO_ERROR;
 }
@@ -59,6 +148,9 @@ ERROR_CODE_E cpu_timer_disable(void)
 ERROR_CODE_E cpu_timer_set_frequency(const uint32_t freq)
 {
     uint32_t     tmp_val;
+    uint32_t     remain;
+    uint32_t     int_state;
+    uint32_t     i;
     ERROR_CODE_E error;
 
     /* Check boundaries */
@@ -78,13 +170,39 @@ ERROR_CODE_E cpu_timer_set_frequency(const uint32_t freq)
         return error;
     }
 
+    /* Compute the nanoseconds per cycle as 32.32 fixed point, the fractional 
+     * part is computed by long division to avoid 64 bits divisions.
+     */
+    clock_ns_int  = 1000000000U / tmp_val;
+    remain        = 1000000000U % tmp_val;
+    clock_ns_frac = 0;
+    for(i = 0; i < 32; ++i)
+    {
+        remain        <<= 1;
+        clock_ns_frac <<= 1;
+        if(remain >= tmp_val)
+        {
+            remain        -= tmp_val;
+            clock_ns_frac |= 1;
+        }
+    }
+
     /* Compute the number of clock ticks required */
     tmp_val = tmp_val / freq;
 
-    /* Sets the register */
+    int_state = cpu_disable_interrupts();
+
+    /* Sets the register, the current period ends on the previous value */
+    if((cpu_timer_read_ctrl() & STK_CTRL_EN) == 0)
+    {
+        clock_period_load = tmp_val;
+    }
     *STK_LOAD_REGISTER = tmp_val;
 
-    tick_freq = freq;
+    tick_freq   = freq;
+    tick_cycles = tmp_val;
+
+    cpu_restore_interrupts(int_state);
 
     return NO_ERROR;
 }
@@ -100,3 +218,164 @@ ERROR_CODE_E cpu_timer_get_frequency(uint32_t* freq)
 
     return NO_ERROR;
 }
+
+ERROR_CODE_E cpu_timer_get_tick_elapsed(uint32_t* cycles)
+{
+    if(cycles == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    /* The system timer counts down from the reload value */
+    *cycles = *STK_LOAD_REGISTER - *STK_VAL_REGISTER;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_timer_suppress_ticks(const uint32_t max_ticks,
+                                      uint32_t* elapsed_ticks)
+{
+    uint32_t ticks;
+    uint32_t ctrl;
+    uint32_t sleep_load;
+    uint32_t elapsed;
+    uint32_t remaining;
+    uint32_t next_load;
+
+    if(elapsed_ticks == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(tick_cycles == 0)
+    {
+        return ERROR_NEED_INIT;
+    }
+
+    /* Clamp the sleep period to the timer capacity */
+    ticks = max_ticks;
+    if(ticks > STK_LOAD_MAX_VALUE / tick_cycles)
+    {
+        ticks = STK_LOAD_MAX_VALUE / tick_cycles;
+    }
+    if(ticks < 2)
+    {
+        *elapsed_ticks = 0;
+        cpu_wait_interrupt();
+        return NO_ERROR;
+    }
+
+    /* Stop the timer and extend the current period by the sleep period */
+    ctrl = cpu_timer_read_ctrl();
+    *STK_CTRL_REGISTER = ctrl & ~(STK_CTRL_EN | STK_CTRL_COUNTFLAG);
+    ctrl |= cpu_timer_read_ctrl();
+    if((ctrl & STK_CTRL_COUNTFLAG) != 0)
+    {
+        /* The period ended, its tick interrupt is pending */
+        *STK_CTRL_REGISTER = cpu_timer_read_ctrl() | STK_CTRL_EN;
+        *elapsed_ticks = 0;
+        return NO_ERROR;
+    }
+    sleep_load = *STK_VAL_REGISTER + tick_cycles * (ticks - 1);
+
+    cpu_timer_restart(sleep_load);
+
+    cpu_wait_interrupt();
+
+    /* Stop the timer, reading COUNTFLAG clears it */
+    ctrl = cpu_timer_read_ctrl();
+    *STK_CTRL_REGISTER = ctrl & ~(STK_CTRL_EN | STK_CTRL_COUNTFLAG);
+    ctrl |= cpu_timer_read_ctrl();
+    if((ctrl & STK_CTRL_COUNTFLAG) != 0)
+    {
+        /* Full period elapsed, the last tick interrupt is left pending */
+        elapsed = sleep_load - *STK_VAL_REGISTER;
+        next_load = (elapsed < tick_cycles) ? tick_cycles - elapsed :
+                                              tick_cycles;
+
+        *elapsed_ticks = ticks - 1;
+    }
+    else
+    {
+        /* Woken up by another interrupt. The sleep period started with the
+         * remainder of the current tick, the tick boundaries fall where the
+         * remaining count is a multiple of the tick period.
+         */
+        remaining = *STK_VAL_REGISTER;
+
+        *elapsed_ticks = ticks - 1 - remaining / tick_cycles;
+        next_load      = remaining % tick_cycles;
+        if(next_load == 0)
+        {
+            /* Woken up on a boundary, its tick is raised now */
+            *SCB_ICSR_REGISTER = SCB_ICSR_PENDSTSET;
+            next_load          = tick_cycles;
+        }
+    }
+
+    /* Restart the timer up to the next tick, then on the regular period */
+    cpu_timer_restart(next_load);
+    *STK_LOAD_REGISTER = tick_cycles;
+
+    return NO_ERROR;
+}
+
+void cpu_timer_tick_update(void)
+{
+    uint32_t int_state;
+
+    int_state = cpu_disable_interrupts();
+    (void)cpu_timer_read_ctrl();
+    cpu_restore_interrupts(int_state);
+}
+
+ERROR_CODE_E cpu_timer_get_time_cycles(uint64_t* cycles)
+{
+    uint32_t int_state;
+    uint32_t value;
+
+    if(cycles == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_disable_interrupts();
+
+    /* Account a reload that happened before reading the count, if the timer
+     * reloads right after, read the count again in the new period.
+     */
+    (void)cpu_timer_read_ctrl();
+    value = *STK_VAL_REGISTER;
+    if((cpu_timer_read_ctrl() & STK_CTRL_COUNTFLAG) != 0)
+    {
+        value = *STK_VAL_REGISTER;
+    }
+    *cycles = clock_base + (clock_period_load - value);
+
+    cpu_restore_interrupts(int_state);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E cpu_timer_get_time_ns(uint64_t* ns)
+{
+    uint64_t     cycles;
+    ERROR_CODE_E error;
+
+    if(ns == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    error = cpu_timer_get_time_cycles(&cycles);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    /* cycles * (int + frac / 2^32) without 64 bits divisions */
+    *ns = cycles * clock_ns_int +
+          (cycles >> 32) * clock_ns_frac +
+          (((cycles & 0xFFFFFFFF) * clock_ns_frac) >> 32);
+
+    return NO_ERROR;
+}
@@ -1,38 +1,63 @@
-/*******************************************************************************
- * @file panic.c
- *
- * @author Alexy Torres Aurora Dugo
- *
- * @date 23/06/2020
- *
- * @version 1.0
- *
- * @brief Cortex M4 implementation of the kernel panic routine.
- *
- * @details Cortex M4 implementation of the kernel panic routine. This module
- * provides routine to set the system state in panic mode.
- ******************************************************************************/
-
-#include "error_types.h"
-#include "panic.h"
-
-/*******************************************************************************
- * Private data
- ******************************************************************************/
-
-/*******************************************************************************
- * Private functions
- ******************************************************************************/
-
-/*******************************************************************************
- * Public functions
- ******************************************************************************/
-
-void kernel_panic(const ERROR_CODE_E reason)
-{
-
-    (void) reason;
-    
-    /* We halt here, the error cannot be recovered */
-    while(1);
+/*******************************************************************************
+ * @file panic.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 23/06/2020
+ *
+ * @version 1.0
+ *
+ * @brief Cortex M4 implementation of the kernel panic routine.
+ *
+ * @details Cortex M4 implementation of the kernel panic routine. This module
+ * provides routine to set the system state in panic mode.
+ ******************************************************************************/
+
+#include "error_types.h"
+#include "config.h"
+#include "cpu_api.h"
+#include "serial.h"
+#include "crash_log.h"
+#include "cpu_mpu_def.h"
+#include "panic_def.h"
+#include "panic.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+void kernel_panic(const ERROR_CODE_E reason)
+{
+#if CONFIG_CRASH_LOG_ENABLED == 1
+    CRASH_LOG_PANIC_T record;
+#endif
+
+    (void)cpu_disable_interrupts();
+
+#if CONFIG_CRASH_LOG_ENABLED == 1
+    /* Keep the panic state for the next boot */
+    record.reason       = (uint32_t)reason;
+    record.caller       = (uint32_t)(uintptr_t)__builtin_return_address(0);
+    record.cpu_state[0] = *SCB_CFSR_REGISTER;
+    record.cpu_state[1] = *SCB_HFSR_REGISTER;
+    record.cpu_state[2] = *SCB_MMFAR_REGISTER;
+    record.cpu_state[3] = *SCB_BFAR_REGISTER;
+    crash_log_set_panic(&record);
+#else
+    (void)reason;
+#endif
+
+    /* Send the queued logs, the serial interrupt is no longer served */
+    serial_flush();
+    
+    /* We halt here, the error cannot be recovered */
+    while(1);
 }
\ No newline at end of file
@@ -1,39 +1,160 @@
-/*******************************************************************************
- * @file cpu_api.h
- *
- * @author Alexy Torres Aurora Dugo
- *
- * @date 25/06/2020
- *
- * @version 1.0
- *
- * @brief CPU API definitions.
- *
- * @details CPU API definitions. This module contains the routines used by the 
- * kernel to access the CPU and use its features.
- ******************************************************************************/
-
-#ifndef __CPU_CPU_API_H__
-#define __CPU_CPU_API_H__
-
-/*******************************************************************************
- * DEFINES
- ******************************************************************************/
-
-/*******************************************************************************
- * STRUCTURES
- ******************************************************************************/
-
-/*******************************************************************************
- * FUNCTIONS
- ******************************************************************************/
-
-/**
- * @brief Full memory barrier.
- * 
- * @details Full memory barrier, both intended to synchronize for data and 
- * instructions barrier.
- */
-void cpu_mem_barrier(void);
-
+/*******************************************************************************
+ * @file cpu_api.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 25/06/2020
+ *
+ * @version 1.0
+ *
+ * @brief CPU API definitions.
+ *
+ * @details CPU API definitions. This module contains the routines used by the 
+ * kernel to access the CPU and use its features.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_API_H__
+#define __CPU_CPU_API_H__
+
+#include "stdint.h"
+#include "stddef.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Full memory barrier.
+ * 
+ * @details Full memory barrier, both intended to synchronize for data and 
+ * instructions barrier.
+ */
+void cpu_mem_barrier(void);
+
+/**
+ * @brief Disables the CPU interrupts.
+ * 
+ * @details Disables the CPU maskable interrupts and returns the previous 
+ * interrupt state. The returned value should be given to 
+ * cpu_restore_interrupts to restore the state.
+ * 
+ * @return The interrupt state before the call is returned.
+ */
+uint32_t cpu_disable_interrupts(void);
+
+/**
+ * @brief Restores the CPU interrupts state.
+ * 
+ * @details Restores the CPU interrupts state saved by a previous call to 
+ * cpu_disable_interrupts.
+ * 
+ * @param[in] state The interrupt state to restore.
+ */
+void cpu_restore_interrupts(const uint32_t state);
+
+/**
+ * @brief Enters a kernel critical section.
+ * 
+ * @details Enters a kernel critical section. Only the interrupts whose 
+ * priority is lower or equal to the kernel interrupt priority ceiling are 
+ * masked, the higher priority interrupts are still served. The returned value
+ * must be given to cpu_exit_critical. Critical sections can be nested.
+ * 
+ * @return The interrupt mask before the call is returned.
+ */
+uint32_t cpu_enter_critical(void);
+
+/**
+ * @brief Exits a kernel critical section.
+ * 
+ * @details Exits a kernel critical section, the interrupt mask saved by the 
+ * matching call to cpu_enter_critical is restored.
+ * 
+ * @param[in] state The interrupt mask to restore.
+ */
+void cpu_exit_critical(const uint32_t state);
+
+/**
+ * @brief Raises the pending service exception.
+ * 
+ * @details Raises the pending service exception. This exception is handled at
+ * the lowest exception priority, once all the other interrupts are handled. The
+ * kernel uses it to perform the deferred context switches.
+ */
+void cpu_raise_pending_service(void);
+
+/**
+ * @brief Waits for an interrupt.
+ * 
+ * @details Puts the CPU in sleep mode until an interrupt is pending. When
+ * called with interrupts disabled, the CPU wakes up on the pending interrupt
+ * which is handled once the interrupts are restored.
+ */
+void cpu_wait_interrupt(void);
+
+/**
+ * @brief Creates a new execution context.
+ * 
+ * @details Creates a new execution context on the stack given as parameter.
+ * When the context is first scheduled, the entry point is called with args as
+ * parameter. If the entry point returns, the exit point is called.
+ * 
+ * @param[in] stack_top The highest address of the stack used by the context.
+ * @param[in] entry The context entry point.
+ * @param[in] args The argument given to the entry point.
+ * @param[in] exit_point The routine called when the entry point returns.
+ * 
+ * @return The saved context pointer to use when restoring the context is 
+ * returned.
+ */
+uintptr_t cpu_init_context(const uintptr_t stack_top,
+                           void (*entry)(void*),
+                           void* args,
+                           void (*exit_point)(void));
+
+/**
+ * @brief Tells if the CPU is executing an interrupt handler.
+ * 
+ * @return 1 is returned if the CPU is executing an interrupt handler, 0 
+ * otherwise.
+ */
+uint32_t cpu_is_interrupt(void);
+
+/**
+ * @brief Tells if an interrupt was raised by unprivileged code.
+ * 
+ * @details Tells if the interrupted code was executing unprivileged in thread
+ * mode.
+ * 
+ * @param[in] cpu_state The interrupted CPU state given to the handler.
+ * 
+ * @return 1 is returned if the interrupted code was unprivileged, 0 otherwise.
+ */
+uint32_t cpu_interrupted_unprivileged(const uintptr_t cpu_state);
+
+/**
+ * @brief Restores the first execution context.
+ * 
+ * @details Restores the first execution context created by cpu_init_context.
+ * The CPU switches to the process stack and jumps to the context's entry
+ * point. The interrupts are enabled by this function.
+ * 
+ * @param[in] context The saved context pointer to restore.
+ * @param[in] unprivileged Set to 1 to start the context unprivileged, 0 
+ * otherwise.
+ * 
+ * @warning This function never returns.
+ */
+void cpu_start_first_context(const uintptr_t context,
+                             const uint32_t unprivileged) 
+    __attribute__((__noreturn__));
+
 #endif /* #ifndef __CPU_CPU_API_H__ */
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * @file cpu_atomic.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief CPU atomic operations module definitions.
+ *
+ * @details CPU atomic operations module definitions. This module contains the
+ * lock-free atomic primitives used by the kernel. They are safe to use from
+ * both thread and interrupt contexts and never mask the interrupts.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_ATOMIC_H__
+#define __CPU_CPU_ATOMIC_H__
+
+#include "stdint.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Atomic compare and swap.
+ * 
+ * @details Atomically replaces the value stored at addr by desired if it 
+ * equals expected.
+ * 
+ * @param[in, out] addr The address of the value to update.
+ * @param[in] expected The value expected at addr.
+ * @param[in] desired The value to store if the current value is expected.
+ * 
+ * @return The value read at addr is returned, the swap succeeded if it equals
+ * expected.
+ */
+uint32_t cpu_atomic_cas(volatile uint32_t* addr, 
+                        const uint32_t expected, 
+                        const uint32_t desired);
+
+/**
+ * @brief Atomic exchange.
+ * 
+ * @details Atomically replaces the value stored at addr by value.
+ * 
+ * @param[in, out] addr The address of the value to update.
+ * @param[in] value The value to store.
+ * 
+ * @return The previous value stored at addr is returned.
+ */
+uint32_t cpu_atomic_swap(volatile uint32_t* addr, const uint32_t value);
+
+/**
+ * @brief Atomic fetch and add.
+ * 
+ * @details Atomically adds value to the value stored at addr.
+ * 
+ * @param[in, out] addr The address of the value to update.
+ * @param[in] value The value to add.
+ * 
+ * @return The previous value stored at addr is returned.
+ */
+uint32_t cpu_atomic_add(volatile uint32_t* addr, const uint32_t value);
+
+#endif /* #ifndef __CPU_CPU_ATOMIC_H__ */
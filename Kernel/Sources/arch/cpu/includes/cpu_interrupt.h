@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * @file cpu_interrupt.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief CPU interrupt vector module definitions.
+ *
+ * @details CPU interrupt vector module definitions. This module contains the
+ * routines used by the kernel to install interrupt service routines directly
+ * in the CPU interrupt vector table and to control the external interrupt 
+ * lines. On architectures that do not propose those features, those 
+ * functions should return an error.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_INTERRUPT_H__
+#define __CPU_CPU_INTERRUPT_H__
+
+#include "error_types.h"
+#include "stdint.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Relocates the interrupt vector table in RAM.
+ * 
+ * @details Copies the boot interrupt vector table to RAM and makes the CPU use
+ * the RAM copy. This must be called before any vector is modified.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_init_vector(void);
+
+/**
+ * @brief Installs an interrupt service routine in the vector table.
+ * 
+ * @details Installs an interrupt service routine directly in the vector table.
+ * The routine is called by the CPU when the exception is raised, without any
+ * software dispatch. The routine must follow the C calling convention.
+ * 
+ * @param[in] vector_id The exception number of the vector to set.
+ * @param[in] isr The interrupt service routine to install.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_set_vector(const uint32_t vector_id, 
+                                      void (*isr)(void));
+
+/**
+ * @brief Restores the boot interrupt service routine of a vector.
+ * 
+ * @details Restores the boot interrupt service routine of a vector. The
+ * exception is routed back to the kernel global interrupt handler.
+ * 
+ * @param[in] vector_id The exception number of the vector to restore.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_restore_vector(const uint32_t vector_id);
+
+/**
+ * @brief Enables an external interrupt line.
+ * 
+ * @details Enables an external interrupt line in the interrupt controller.
+ * 
+ * @param[in] line The external interrupt line to enable.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_enable_line(const uint32_t line);
+
+/**
+ * @brief Disables an external interrupt line.
+ * 
+ * @details Disables an external interrupt line in the interrupt controller.
+ * A pending interrupt stays pending but is not taken.
+ * 
+ * @param[in] line The external interrupt line to disable.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_disable_line(const uint32_t line);
+
+/**
+ * @brief Sets the priority of an external interrupt line.
+ * 
+ * @details Sets the priority of an external interrupt line, 0 being the 
+ * highest priority. A higher priority interrupt preempts the lower priority
+ * ones. The lines default to the kernel interrupt priority ceiling. Lines set
+ * to a higher priority than the ceiling are never masked by the kernel and 
+ * must not call the kernel API.
+ * 
+ * @param[in] line The external interrupt line to set.
+ * @param[in] priority The priority to set, lower than the number of priority
+ * levels of the CPU.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_set_priority(const uint32_t line, 
+                                        const uint32_t priority);
+
+/**
+ * @brief Gets the priority of an external interrupt line.
+ * 
+ * @details Gets the priority of an external interrupt line, 0 being the 
+ * highest priority.
+ * 
+ * @param[in] line The external interrupt line to get.
+ * @param[out] priority The pointer to store the priority.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_get_priority(const uint32_t line, 
+                                        uint32_t* priority);
+
+/**
+ * @brief Sets an external interrupt line pending.
+ * 
+ * @details Sets an external interrupt line pending, the interrupt is taken 
+ * as soon as its priority allows it if the line is enabled.
+ * 
+ * @param[in] line The external interrupt line to set pending.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_set_pending(const uint32_t line);
+
+/**
+ * @brief Clears the pending state of an external interrupt line.
+ * 
+ * @details Clears the pending state of an external interrupt line.
+ * 
+ * @param[in] line The external interrupt line to clear.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_clear_pending(const uint32_t line);
+
+/**
+ * @brief Gets the pending state of an external interrupt line.
+ * 
+ * @details Gets the pending state of an external interrupt line.
+ * 
+ * @param[in] line The external interrupt line to query.
+ * @param[out] pending The pointer to store the state, set to 1 if the line is
+ * pending, 0 otherwise.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_is_pending(const uint32_t line, uint8_t* pending);
+
+/**
+ * @brief Gets the active state of an external interrupt line.
+ * 
+ * @details Gets the active state of an external interrupt line. A line is
+ * active while its handler runs or is preempted.
+ * 
+ * @param[in] line The external interrupt line to query.
+ * @param[out] active The pointer to store the state, set to 1 if the line is
+ * active, 0 otherwise.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_interrupt_is_active(const uint32_t line, uint8_t* active);
+
+#endif /* #ifndef __CPU_CPU_INTERRUPT_H__ */
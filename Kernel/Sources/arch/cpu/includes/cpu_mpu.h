@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * @file cpu_mpu.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief CPU memory protection module definitions.
+ *
+ * @details CPU memory protection module definitions. This module contains the
+ * routines used by the kernel to protect the stacks with guard regions. An
+ * access to a guard region raises a memory management fault. On architectures
+ * that do not propose memory protection, those functions should return an 
+ * error.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_MPU_H__
+#define __CPU_CPU_MPU_H__
+
+#include "error_types.h"
+#include "stdint.h"
+#include "stddef.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Memory protection region, as installed by the context switch. */
+struct CPU_MPU_REGION
+{
+    /** @brief Region base address and identifier. */
+    uint32_t base;
+    /** @brief Region size and access attributes. */
+    uint32_t attributes;
+};
+
+/** @brief Short hand for struct CPU_MPU_REGION */
+typedef struct CPU_MPU_REGION CPU_MPU_REGION_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes the memory protection.
+ * 
+ * @details Initializes the memory protection. The privileged default memory 
+ * map is kept, a guard region is set at the bottom of the main stack and the
+ * memory management fault is enabled. Unprivileged code is given read only 
+ * access to the flash and read/write access to the user data region.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_mpu_init(void);
+
+/**
+ * @brief Computes the stack guard of a task stack.
+ * 
+ * @details Computes the stack guard value protecting the bottom of a task 
+ * stack. The guard covers at most the first 64 bytes of the stack. The value
+ * is installed by the context switch each time the task is elected.
+ * 
+ * @param[in] stack_base The lowest address of the stack.
+ * @param[out] guard The pointer to store the guard value.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_mpu_get_stack_guard(const uintptr_t stack_base, 
+                                     uint32_t* guard);
+
+/**
+ * @brief Installs a task stack guard.
+ * 
+ * @details Installs a task stack guard computed by cpu_mpu_get_stack_guard.
+ * 
+ * @param[in] guard The guard value to install.
+ */
+void cpu_mpu_set_stack_guard(const uint32_t guard);
+
+/**
+ * @brief Computes the stack region of a task.
+ * 
+ * @details Computes the stack region giving an unprivileged task access to 
+ * its stack. The stack size must be a power of two of at least 32 bytes and
+ * the stack must be aligned on its size. For privileged tasks, the region is
+ * disabled. The region is installed by the context switch each time the task
+ * is elected.
+ * 
+ * @param[in] stack_base The lowest address of the stack.
+ * @param[in] stack_size The size in bytes of the stack.
+ * @param[in] unprivileged Set to 1 if the task is unprivileged, 0 otherwise.
+ * @param[out] region The pointer to store the region.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_mpu_get_stack_region(const uintptr_t stack_base,
+                                      const size_t stack_size,
+                                      const uint8_t unprivileged,
+                                      CPU_MPU_REGION_T* region);
+
+/**
+ * @brief Installs a task stack region.
+ * 
+ * @details Installs a task stack region computed by cpu_mpu_get_stack_region.
+ * 
+ * @param[in] region The region to install.
+ */
+void cpu_mpu_set_stack_region(const CPU_MPU_REGION_T* region);
+
+/**
+ * @brief Gets the memory management fault information.
+ * 
+ * @details Gets the memory management fault information. The fault address is
+ * only valid if the function returns NO_ERROR.
+ * 
+ * @param[out] addr The pointer to store the faulting address.
+ * @param[out] on_stacking The pointer to store the stacking state, set to 1 if
+ * the fault occured while stacking the exception frame, 0 otherwise.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_mpu_get_fault(uintptr_t* addr, uint8_t* on_stacking);
+
+#endif /* #ifndef __CPU_CPU_MPU_H__ */
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * @file cpu_profile.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief CPU cycle profiling module definitions.
+ *
+ * @details CPU cycle profiling module definitions. This module contains the
+ * routines used to measure code sections with the CPU cycle counter. Each 
+ * named probe keeps the minimal, maximal and mean duration of its 
+ * measurements. The measurement macros are removed when 
+ * CONFIG_CPU_PROFILE_ENABLED is not set. On architectures that do not propose
+ * a cycle counter, those functions should return an error.
+ ******************************************************************************/
+
+#ifndef __CPU_CPU_PROFILE_H__
+#define __CPU_CPU_PROFILE_H__
+
+#include "error_types.h"
+#include "stdint.h"
+#include "stddef.h"
+#include "config.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+#if CONFIG_CPU_PROFILE_ENABLED == 1
+
+/** @brief Starts a measurement on a probe. */
+#define CPU_PROFILE_BEGIN(probe) cpu_profile_begin(probe)
+
+/** @brief Ends a measurement on a probe. */
+#define CPU_PROFILE_END(probe) cpu_profile_end(probe)
+
+/** 
+ * @brief Measures the following statement or block on a probe. The block must
+ * not be left with return, break or goto.
+ */
+#define CPU_PROFILE_SCOPE(probe)                                   \
+    for(uint32_t cpu_profile_once = (cpu_profile_begin(probe), 1); \
+        cpu_profile_once != 0;                                     \
+        cpu_profile_once = (cpu_profile_end(probe), 0))
+
+#else
+
+#define CPU_PROFILE_BEGIN(probe) ((void)(probe))
+#define CPU_PROFILE_END(probe)   ((void)(probe))
+#define CPU_PROFILE_SCOPE(probe) if(((void)(probe), 1))
+
+#endif
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Profiling probe. */
+struct CPU_PROFILE_PROBE
+{
+    /** @brief Probe's name. */
+    const char* name;
+
+    /** @brief Cycle count at the start of the current measurement. */
+    uint32_t start;
+
+    /** @brief Number of measurements. */
+    uint32_t count;
+    /** @brief Shortest measurement in cycles. */
+    uint32_t min;
+    /** @brief Longest measurement in cycles. */
+    uint32_t max;
+    /** @brief Sum of the measurements in cycles. */
+    uint64_t total;
+
+    /** @brief Next registered probe. */
+    struct CPU_PROFILE_PROBE* next;
+};
+
+/** @brief Short hand for struct CPU_PROFILE_PROBE */
+typedef struct CPU_PROFILE_PROBE CPU_PROFILE_PROBE_T;
+
+/** @brief Profiling probe statistics, as dumped by the logger. */
+struct CPU_PROFILE_STATS
+{
+    /** @brief Number of measurements. */
+    uint32_t count;
+    /** @brief Shortest measurement in cycles. */
+    uint32_t min;
+    /** @brief Longest measurement in cycles. */
+    uint32_t max;
+    /** @brief Mean measurement in cycles. */
+    uint32_t mean;
+};
+
+/** @brief Short hand for struct CPU_PROFILE_STATS */
+typedef struct CPU_PROFILE_STATS CPU_PROFILE_STATS_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes the CPU cycle counter.
+ * 
+ * @details Enables the CPU cycle counter and measures the overhead of an empty
+ * measurement, which is removed from all the measurements.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_profile_init(void);
+
+/**
+ * @brief Gets the CPU cycle counter.
+ * 
+ * @details Gets the CPU cycle counter, it wraps around every 2^32 cycles.
+ * 
+ * @return The current CPU cycle count is returned.
+ */
+uint32_t cpu_profile_get_cycles(void);
+
+/**
+ * @brief Initializes and registers a profiling probe.
+ * 
+ * @details Initializes a profiling probe and adds it to the probes dumped by
+ * cpu_profile_dump_all. The probe memory is provided by the caller and must 
+ * stay valid.
+ * 
+ * @param[out] probe The probe to initialize.
+ * @param[in] name The probe's name.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_profile_probe_init(CPU_PROFILE_PROBE_T* probe, 
+                                    const char* name);
+
+/**
+ * @brief Starts a measurement on a probe.
+ * 
+ * @details Starts a measurement on a probe. A probe must only be used by one
+ * execution context at a time.
+ * 
+ * @param[in, out] probe The probe to start.
+ */
+void cpu_profile_begin(CPU_PROFILE_PROBE_T* probe);
+
+/**
+ * @brief Ends a measurement on a probe.
+ * 
+ * @details Ends the current measurement on a probe and updates its 
+ * statistics.
+ * 
+ * @param[in, out] probe The probe to end.
+ */
+void cpu_profile_end(CPU_PROFILE_PROBE_T* probe);
+
+/**
+ * @brief Resets the statistics of a probe.
+ * 
+ * @param[in, out] probe The probe to reset.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_profile_reset(CPU_PROFILE_PROBE_T* probe);
+
+/**
+ * @brief Gets the statistics of a probe.
+ * 
+ * @param[in] probe The probe to get the statistics of.
+ * @param[out] stats The buffer to receive the statistics.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_profile_get_stats(const CPU_PROFILE_PROBE_T* probe,
+                                   CPU_PROFILE_STATS_T* stats);
+
+/**
+ * @brief Dumps the statistics of all the registered probes.
+ * 
+ * @details Dumps the statistics of all the registered probes with the kernel 
+ * logger, at the information level. Each probe is logged with its name 
+ * address, count, minimum, maximum and mean.
+ */
+void cpu_profile_dump_all(void);
+
+#endif /* #ifndef __CPU_CPU_PROFILE_H__ */
@@ -82,5 +82,78 @@ ERROR_CODE_E cpu_timer_set_frequency(const uint32_t freq);
  */
 ERROR_CODE_E cpu_timer_get_frequency(uint32_t* freq);
 
+/**
+ * @brief Gets the number of CPU timer cycles elapsed since the last tick.
+ * 
+ * @details Gets the number of CPU timer cycles elapsed since the last tick. 
+ * When called from the tick interrupt handler, this corresponds to the latency
+ * between the tick and the call.
+ * 
+ * @param[out] cycles The pointer to store the number of elapsed cycles.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_timer_get_tick_elapsed(uint32_t* cycles);
+
+/**
+ * @brief Suppresses the CPU timer ticks and puts the CPU to sleep.
+ * 
+ * @details Reprograms the CPU timer to expire after max_ticks ticks, at most
+ * the timer's maximal reload value, and puts the CPU to sleep until an
+ * interrupt occurs. On wake up, the timer is reprogrammed to raise the next
+ * tick on its original period boundary. This must be called with interrupts
+ * disabled. When the full period elapsed, or when the CPU wakes up on a tick
+ * boundary, the tick interrupt is left pending and this last tick is not 
+ * accounted in elapsed_ticks.
+ * 
+ * @param[in] max_ticks The number of ticks until the next deadline.
+ * @param[out] elapsed_ticks The pointer to store the number of ticks that
+ * elapsed while sleeping.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_timer_suppress_ticks(const uint32_t max_ticks,
+                                      uint32_t* elapsed_ticks);
+
+/**
+ * @brief Accounts the CPU timer periods in the monotonic clock.
+ * 
+ * @details Accounts the CPU timer periods that elapsed since the last update
+ * in the monotonic clock. This must be called by the tick interrupt handler 
+ * at each tick.
+ */
+void cpu_timer_tick_update(void);
+
+/**
+ * @brief Gets the monotonic clock in CPU cycles.
+ * 
+ * @details Gets the number of CPU cycles elapsed since the CPU timer was 
+ * enabled. The value combines the elapsed timer periods with the current 
+ * timer count and is consistent from any context, including interrupt 
+ * handlers above the kernel interrupt priority ceiling.
+ * 
+ * @param[out] cycles The pointer to store the number of elapsed cycles.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_timer_get_time_cycles(uint64_t* cycles);
+
+/**
+ * @brief Gets the monotonic clock in nanoseconds.
+ * 
+ * @details Gets the number of nanoseconds elapsed since the CPU timer was 
+ * enabled, with the resolution of one CPU cycle. The conversion uses a fixed
+ * point multiplier computed when the tick frequency is set.
+ * 
+ * @param[out] ns The pointer to store the number of elapsed nanoseconds.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E cpu_timer_get_time_ns(uint64_t* ns);
+
 
 #endif /* #ifndef __CPU_CPU_TIMER_H__ */
\ No newline at end of file
@@ -35,6 +35,8 @@
  * 
  * @details Kernel panic endpoint. This function is dedicated to handle a kernel
  * panic. It outpus the current system's state before putting it in halted mode.
+ * When the crash log is enabled, the panic record is retained for the next 
+ * boot.
  * 
  * @param[in] reason The reason of the kernel panic.
  * 
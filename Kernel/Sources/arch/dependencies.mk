@@ -1,8 +1,8 @@
-DEP_INCLUDES = -I ../../../../types/includes/
-DEP_INCLUDES += -I ../../../../io/includes/
-DEP_INCLUDES += -I ../../../board/includes/
-DEP_INCLUDES += -I ../../../cpu/includes/
-DEP_INCLUDES += -I ../../../../lib/includes/
-DEP_INCLUDES += -I ../../../../core/includes/
-
+DEP_INCLUDES = -I ../../../../types/includes/
+DEP_INCLUDES += -I ../../../../io/includes/
+DEP_INCLUDES += -I ../../../board/includes/
+DEP_INCLUDES += -I ../../../cpu/includes/
+DEP_INCLUDES += -I ../../../../lib/includes/
+DEP_INCLUDES += -I ../../../../core/includes/
+
 DEP_LIBS=
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * @file deferred_work.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel deferred interrupt work.
+ *
+ * @details Kernel deferred interrupt work. Interrupt handlers post work items
+ * to a lock-free queue. The queue is drained by the pending service exception
+ * at the lowest exception priority, before any context switch. The interrupt
+ * handlers stay short and the latency of the higher priority interrupts is 
+ * bounded.
+ ******************************************************************************/
+
+#ifndef __CORE_DEFERRED_WORK_H__
+#define __CORE_DEFERRED_WORK_H__
+
+#include "stdint.h"
+#include "error_types.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Deferred work item. */
+struct KERNEL_DEFERRED_WORK
+{
+    /** @brief Next work item in the queue. */
+    struct KERNEL_DEFERRED_WORK* next;
+
+    /** @brief Routine to execute. */
+    void (*routine)(void*);
+    /** @brief Argument given to the routine. */
+    void* args;
+
+    /** @brief Set while the work item is queued. */
+    volatile uint32_t pending;
+};
+
+/** @brief Short hand for struct KERNEL_DEFERRED_WORK */
+typedef struct KERNEL_DEFERRED_WORK KERNEL_DEFERRED_WORK_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes a deferred work item.
+ *
+ * @details Initializes a deferred work item. The work item memory is provided
+ * by the caller and must stay valid while the item is queued.
+ *
+ * @param[out] work The work item to initialize.
+ * @param[in] routine The routine executed when the work is processed.
+ * @param[in] args The argument given to the routine.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_deferred_work_init(KERNEL_DEFERRED_WORK_T* work,
+                                       void (*routine)(void*),
+                                       void* args);
+
+/**
+ * @brief Posts a deferred work item.
+ *
+ * @details Posts a deferred work item and raises the pending service exception
+ * to process it. This function is lock-free and can be called from any
+ * interrupt handler, including the ones above the kernel interrupt priority
+ * ceiling. Posting an item that is already queued has no effect, its routine
+ * is executed once.
+ *
+ * @param[in] work The work item to post.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_deferred_work_post(KERNEL_DEFERRED_WORK_T* work);
+
+/**
+ * @brief Processes the queued deferred work items.
+ *
+ * @details Processes the queued deferred work items in their posting order. 
+ * The items posted while processing are handled by the next call.
+ *
+ * @warning This function is called by the pending service exception handler
+ * and should not be called elsewhere.
+ */
+void kernel_deferred_work_drain(void);
+
+#endif /* #ifndef __CORE_DEFERRED_WORK_H__ */
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * @file event_group.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel event flag groups.
+ *
+ * @details Kernel event flag groups. An event group holds 32 event flags. 
+ * Interrupt handlers and tasks set several flags in a single operation and 
+ * tasks wait until any or all the flags of a mask are set, optionally 
+ * clearing them when the wait is satisfied.
+ ******************************************************************************/
+
+#ifndef __CORE_EVENT_GROUP_H__
+#define __CORE_EVENT_GROUP_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "scheduler.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Wait option: wait until any flag of the mask is set. */
+#define KERNEL_EVENT_WAIT_ANY 0x00000000
+/** @brief Wait option: wait until all the flags of the mask are set. */
+#define KERNEL_EVENT_WAIT_ALL 0x00000001
+/** @brief Wait option: clear the flags of the mask when the wait succeeds. */
+#define KERNEL_EVENT_CLEAR    0x00000002
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Kernel event flag group. */
+struct KERNEL_EVENT_GROUP
+{
+    /** @brief Event group's name. */
+    const char* name;
+
+    /** @brief Current event flags. */
+    volatile uint32_t flags;
+
+    /** @brief Tasks waiting for flags. */
+    KERNEL_WAIT_QUEUE_T waiters;
+};
+
+/** @brief Short hand for struct KERNEL_EVENT_GROUP */
+typedef struct KERNEL_EVENT_GROUP KERNEL_EVENT_GROUP_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes an event group.
+ *
+ * @details Initializes an event group with all its flags cleared.
+ *
+ * @param[out] group The event group to initialize.
+ * @param[in] name The event group's name.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_event_init(KERNEL_EVENT_GROUP_T* group, const char* name);
+
+/**
+ * @brief Sets flags in an event group.
+ *
+ * @details Sets flags in an event group and wakes up all the tasks whose wait
+ * condition is satisfied, in priority order. The flags requested to be 
+ * cleared by the woken tasks are cleared once all the waiters were checked.
+ * This can be called from interrupt handlers.
+ *
+ * @param[in, out] group The event group to update.
+ * @param[in] flags The flags to set.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_event_set(KERNEL_EVENT_GROUP_T* group, 
+                              const uint32_t flags);
+
+/**
+ * @brief Clears flags in an event group.
+ *
+ * @param[in, out] group The event group to update.
+ * @param[in] flags The flags to clear.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_event_clear(KERNEL_EVENT_GROUP_T* group, 
+                                const uint32_t flags);
+
+/**
+ * @brief Gets the flags of an event group.
+ *
+ * @param[in] group The event group to read.
+ *
+ * @return The current event flags are returned, 0 if the group is NULL.
+ */
+uint32_t kernel_event_get(const KERNEL_EVENT_GROUP_T* group);
+
+/**
+ * @brief Waits for flags in an event group.
+ *
+ * @details Waits until any or all the flags of the mask are set in an event
+ * group. Interrupt handlers must use a null timeout.
+ *
+ * @param[in, out] group The event group to wait on.
+ * @param[in] mask The flags to wait for.
+ * @param[in] options The wait options, a combination of KERNEL_EVENT_WAIT_ANY
+ * or KERNEL_EVENT_WAIT_ALL and KERNEL_EVENT_CLEAR.
+ * @param[in] timeout The maximal number of ticks to wait, KERNEL_WAIT_FOREVER
+ * to wait without time limit.
+ * @param[out] flags The buffer to receive the event flags that satisfied the 
+ * wait, before they are cleared. Can be NULL.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_TIMEOUT is returned
+ * if the condition was not satisfied in time. Otherwise an error code is 
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_event_wait(KERNEL_EVENT_GROUP_T* group,
+                               const uint32_t mask,
+                               const uint32_t options,
+                               const uint32_t timeout,
+                               uint32_t* flags);
+
+#endif /* #ifndef __CORE_EVENT_GROUP_H__ */
@@ -18,6 +18,8 @@
 #define __CORE_INTERRRUPTS_H__
 
 #include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
 
 /*******************************************************************************
  * DEFINES
@@ -30,13 +32,26 @@
 /**
  * @brief Defines the different interrupt indentifiers available in the kernel.
  * 
+ * @details Defines the different interrupt indentifiers available in the 
+ * kernel. The identifiers match the CPU exception numbers so that each 
+ * exception is routed to its own handler.
+ * 
  * @warning The interrupts IDs should be the same as defined in the 
  * interrupt.inc file.
  */
 enum INTERRUPT_ID
 {
-    INT_SYS_CALL_ID = 0,
-    INT_SYS_TICK_ID = 1
+    INT_NMI_ID         = 2,
+    INT_HARD_FAULT_ID  = 3,
+    INT_MPU_FAULT_ID   = 4,
+    INT_BUS_FAULT_ID   = 5,
+    INT_USAGE_FAULT_ID = 6,
+    INT_SYS_CALL_ID    = 11,
+    INT_DEBUG_ID       = 12,
+    INT_PENDSV_ID      = 14,
+    INT_SYS_TICK_ID    = 15,
+    /** @brief First external interrupt line, line N uses this ID + N. */
+    INT_EXT_FIRST_ID   = 16
 };
 
 /** @brief Short hand for enum INTERRUPT_ID */
@@ -57,5 +72,84 @@ typedef struct KERNEL_INT_HANDLER KERNEL_INT_HANDLER_T;
  * FUNCTIONS
  ******************************************************************************/
 
+/**
+ * @brief Initializes the kernel interrupt management.
+ * 
+ * @details Initializes the kernel interrupt management. The CPU interrupt 
+ * vector table is relocated in RAM so that interrupt service routines can be
+ * installed directly.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_interrupt_init(void);
+
+/**
+ * @brief Registers a kernel interrupt handler.
+ * 
+ * @details Registers a kernel interrupt handler for the interrupt identifier
+ * given as parameter. The handler will be called by the kernel global 
+ * interrupt handler each time the interrupt is raised. The interrupt must not
+ * have a directly installed interrupt service routine.
+ * 
+ * @param[in] int_number The interrupt identifier to attach the handler to.
+ * @param[in] handler The handler routine to call when the interrupt is raised.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_interrupt_register_handler(const INTERRUPT_ID_T int_number,
+                                               void (*handler)(
+                                                   const INTERRUPT_ID_T,
+                                                   const uintptr_t,
+                                                   const uintptr_t));
+
+/**
+ * @brief Removes a kernel interrupt handler.
+ * 
+ * @details Removes the kernel interrupt handler attached to the interrupt
+ * identifier given as parameter.
+ * 
+ * @param[in] int_number The interrupt identifier to detach the handler from.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_interrupt_remove_handler(const INTERRUPT_ID_T int_number);
+
+/**
+ * @brief Installs an interrupt service routine.
+ * 
+ * @details Installs an interrupt service routine directly in the CPU vector
+ * table. The routine is called by the CPU when the interrupt is raised, the 
+ * kernel global interrupt handler is bypassed. This is intended for latency
+ * critical interrupts. The interrupt must not have a kernel handler registered
+ * or a routine already installed. The faults, system call and pending service
+ * vectors are reserved by the kernel and cannot be overridden.
+ * 
+ * @param[in] int_number The interrupt identifier to attach the routine to.
+ * @param[in] isr The interrupt service routine.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_interrupt_set_isr(const INTERRUPT_ID_T int_number,
+                                      void (*isr)(void));
+
+/**
+ * @brief Removes an interrupt service routine.
+ * 
+ * @details Removes the interrupt service routine installed for the interrupt
+ * identifier given as parameter. The interrupt is routed back to the kernel 
+ * global interrupt handler. The routine must have been installed with
+ * kernel_interrupt_set_isr.
+ * 
+ * @param[in] int_number The interrupt identifier to detach the routine from.
+ * 
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_interrupt_remove_isr(const INTERRUPT_ID_T int_number);
+
 
 #endif /* #ifndef __CORE_INTERRRUPTS_H__ */
\ No newline at end of file
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * @file kernel_bench.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel boot benchmarks.
+ *
+ * @details Kernel boot benchmarks. When CONFIG_KERNEL_BENCH_ENABLED is set, a
+ * privileged task measures the cost of the kernel primitives with the CPU
+ * cycle counter at boot. The results are logged as profiling probes once the
+ * measurements are done.
+ ******************************************************************************/
+
+#ifndef __CORE_KERNEL_BENCH_H__
+#define __CORE_KERNEL_BENCH_H__
+
+#include "error_types.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Creates the kernel benchmark task.
+ *
+ * @details Creates the kernel benchmark task at the highest priority. The
+ * task runs the benchmarks once the scheduler is started, logs the profiling
+ * probes and exits.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_bench_start(void);
+
+#endif /* #ifndef __CORE_KERNEL_BENCH_H__ */
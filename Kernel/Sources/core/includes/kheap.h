@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * @file kheap.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel general purpose heap allocator.
+ *
+ * @details Kernel general purpose heap allocator. The allocator is a two-level
+ * segregated fit (TLSF) allocator managing the kernel heap region defined by
+ * the linker script. Allocating and releasing memory is done in bounded 
+ * constant time, whatever the heap state.
+ ******************************************************************************/
+
+#ifndef __CORE_KHEAP_H__
+#define __CORE_KHEAP_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Alignment of the allocated memory in bytes. */
+#define KHEAP_ALIGN 8
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Kernel heap statistics. */
+struct KHEAP_STATS
+{
+    /** @brief Size in bytes of the memory managed by the heap. */
+    size_t total_size;
+    /** @brief Size in bytes of the free memory. */
+    size_t free_size;
+    /** @brief Minimal size in bytes of the free memory ever reached. */
+    size_t min_free_size;
+    /** @brief Size in bytes of the largest free block. */
+    size_t largest_free_block;
+    /** @brief Fragmentation of the free memory in percent. */
+    uint32_t fragmentation;
+
+    /** @brief Number of successful allocations. */
+    uint32_t alloc_count;
+    /** @brief Number of releases. */
+    uint32_t free_count;
+    /** @brief Number of allocations that failed. */
+    uint32_t fail_count;
+};
+
+/** @brief Short hand for struct KHEAP_STATS */
+typedef struct KHEAP_STATS KHEAP_STATS_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes the kernel heap.
+ *
+ * @details Initializes the kernel heap with the heap region defined by the 
+ * linker script, located between the BSS and the main stack.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kheap_init(void);
+
+/**
+ * @brief Allocates memory from the kernel heap.
+ *
+ * @details Allocates size bytes from the kernel heap in bounded time. The 
+ * returned memory is aligned on KHEAP_ALIGN bytes.
+ *
+ * @param[in] size The number of bytes to allocate.
+ *
+ * @return A pointer to the allocated memory is returned. NULL is returned if
+ * not enough memory is available.
+ */
+void* kmalloc(const size_t size);
+
+/**
+ * @brief Releases memory to the kernel heap.
+ *
+ * @details Releases memory allocated with kmalloc in bounded time. The 
+ * released block is merged with its free neighbours.
+ *
+ * @param[in] ptr The memory to release.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kfree(void* ptr);
+
+/**
+ * @brief Gets the kernel heap statistics.
+ *
+ * @details Gets the kernel heap usage and fragmentation statistics. The 
+ * fragmentation is the share of the free memory that is not part of the 
+ * largest free block.
+ *
+ * @param[out] stats The buffer to receive the statistics.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kheap_get_stats(KHEAP_STATS_T* stats);
+
+#endif /* #ifndef __CORE_KHEAP_H__ */
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * @file mem_pool.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel fixed-size block memory pools.
+ *
+ * @details Kernel fixed-size block memory pools. A pool manages a set of 
+ * blocks of the same size allocated from the kernel heap. Allocating and
+ * releasing a block is done in constant time and can be done from interrupt
+ * handlers.
+ ******************************************************************************/
+
+#ifndef __CORE_MEM_POOL_H__
+#define __CORE_MEM_POOL_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Alignment of the pool blocks in bytes. */
+#define MEM_POOL_BLOCK_ALIGN 8
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Free block header, stored in the free block itself. */
+struct MEM_POOL_BLOCK
+{
+    /** @brief Next free block. */
+    struct MEM_POOL_BLOCK* next;
+};
+
+/** @brief Short hand for struct MEM_POOL_BLOCK */
+typedef struct MEM_POOL_BLOCK MEM_POOL_BLOCK_T;
+
+/** @brief Fixed-size block memory pool. */
+struct MEM_POOL
+{
+    /** @brief Pool's name. */
+    const char* name;
+
+    /** @brief Free blocks list. */
+    MEM_POOL_BLOCK_T* free_list;
+
+    /** @brief First block address. */
+    uintptr_t start;
+    /** @brief End address of the last block. */
+    uintptr_t end;
+
+    /** @brief Size of a block in bytes, aligned on MEM_POOL_BLOCK_ALIGN. */
+    size_t block_size;
+    /** @brief Number of blocks in the pool. */
+    uint32_t block_count;
+
+    /** @brief Number of blocks currently allocated. */
+    uint32_t used_count;
+    /** @brief Maximal number of blocks allocated at the same time. */
+    uint32_t high_water;
+    /** @brief Number of allocations that failed. */
+    uint32_t fail_count;
+};
+
+/** @brief Short hand for struct MEM_POOL */
+typedef struct MEM_POOL MEM_POOL_T;
+
+/** @brief Memory pool statistics. */
+struct MEM_POOL_STATS
+{
+    /** @brief Size of a block in bytes. */
+    size_t block_size;
+    /** @brief Number of blocks in the pool. */
+    uint32_t block_count;
+    /** @brief Number of blocks currently allocated. */
+    uint32_t used_count;
+    /** @brief Maximal number of blocks allocated at the same time. */
+    uint32_t high_water;
+    /** @brief Number of allocations that failed. */
+    uint32_t fail_count;
+};
+
+/** @brief Short hand for struct MEM_POOL_STATS */
+typedef struct MEM_POOL_STATS MEM_POOL_STATS_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Creates a memory pool.
+ *
+ * @details Creates a memory pool of block_count blocks of block_size bytes. 
+ * The blocks are allocated from the kernel heap in a single allocation.
+ *
+ * @param[out] pool The pool to create.
+ * @param[in] name The pool's name.
+ * @param[in] block_size The size of a block in bytes.
+ * @param[in] block_count The number of blocks in the pool.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E mem_pool_create(MEM_POOL_T* pool,
+                             const char* name,
+                             const size_t block_size,
+                             const uint32_t block_count);
+
+/**
+ * @brief Destroys a memory pool.
+ *
+ * @details Destroys a memory pool, its memory is released to the kernel heap.
+ * All the blocks of the pool must have been released.
+ *
+ * @param[in, out] pool The pool to destroy.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E mem_pool_destroy(MEM_POOL_T* pool);
+
+/**
+ * @brief Allocates a block from a memory pool.
+ *
+ * @details Allocates a block from a memory pool in constant time.
+ *
+ * @param[in, out] pool The pool to allocate from.
+ *
+ * @return The allocated block is returned. NULL is returned if the pool is 
+ * exhausted.
+ */
+void* mem_pool_alloc(MEM_POOL_T* pool);
+
+/**
+ * @brief Releases a block to its memory pool.
+ *
+ * @details Releases a block to its memory pool in constant time.
+ *
+ * @param[in, out] pool The pool the block was allocated from.
+ * @param[in] block The block to release.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E mem_pool_free(MEM_POOL_T* pool, void* block);
+
+/**
+ * @brief Gets the statistics of a memory pool.
+ *
+ * @details Gets the usage and high-water statistics of a memory pool.
+ *
+ * @param[in] pool The pool to get the statistics of.
+ * @param[out] stats The buffer to receive the statistics.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E mem_pool_get_stats(const MEM_POOL_T* pool, 
+                                MEM_POOL_STATS_T* stats);
+
+#endif /* #ifndef __CORE_MEM_POOL_H__ */
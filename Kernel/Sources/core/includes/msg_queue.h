@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * @file msg_queue.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel zero-copy message queues.
+ *
+ * @details Kernel zero-copy message queues. A message queue carries pointers
+ * to buffers owned by the users, the payloads are never copied: sending a 
+ * message gives the buffer ownership to the receiver. When a task is already
+ * waiting, the message is handed to it directly. Sending and receiving can 
+ * block with a timeout expressed in system ticks. Interrupt handlers can send
+ * and receive messages with a null timeout.
+ ******************************************************************************/
+
+#ifndef __CORE_MSG_QUEUE_H__
+#define __CORE_MSG_QUEUE_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "scheduler.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Zero-copy message queue. */
+struct MSG_QUEUE
+{
+    /** @brief Queue's name. */
+    const char* name;
+
+    /** @brief Messages storage, allocated from the kernel heap. */
+    void** messages;
+    /** @brief Maximal number of messages stored in the queue. */
+    uint32_t capacity;
+
+    /** @brief Index of the oldest message. */
+    uint32_t head;
+    /** @brief Number of messages stored in the queue. */
+    uint32_t count;
+
+    /** @brief Tasks waiting for a message. */
+    KERNEL_WAIT_QUEUE_T receivers;
+    /** @brief Tasks waiting for free space, their message is in wait_data. */
+    KERNEL_WAIT_QUEUE_T senders;
+
+    /** @brief Maximal number of messages stored at the same time. */
+    uint32_t high_water;
+};
+
+/** @brief Short hand for struct MSG_QUEUE */
+typedef struct MSG_QUEUE MSG_QUEUE_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Creates a message queue.
+ *
+ * @details Creates a message queue, the message storage is allocated from the
+ * kernel heap. A queue with a null capacity stores no message, senders and
+ * receivers meet directly.
+ *
+ * @param[out] queue The queue to initialize.
+ * @param[in] name The queue's name.
+ * @param[in] capacity The maximal number of messages stored in the queue.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E msg_queue_create(MSG_QUEUE_T* queue,
+                              const char* name,
+                              const uint32_t capacity);
+
+/**
+ * @brief Destroys a message queue.
+ *
+ * @details Destroys a message queue and releases its storage. The queue must
+ * not have waiting tasks. The stored messages are dropped.
+ *
+ * @param[in, out] queue The queue to destroy.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E msg_queue_destroy(MSG_QUEUE_T* queue);
+
+/**
+ * @brief Sends a message.
+ *
+ * @details Sends a message, the buffer ownership is given to the receiver. If
+ * a task waits for a message, the message is given to it directly. If the 
+ * queue is full, the caller waits for free space until the timeout expires.
+ * Interrupt handlers must use a null timeout.
+ *
+ * @param[in, out] queue The queue to send to.
+ * @param[in] msg The message to send.
+ * @param[in] timeout The maximal number of ticks to wait, KERNEL_WAIT_FOREVER
+ * to wait without time limit.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_TIMEOUT is returned
+ * if the queue stayed full. Otherwise an error code is returned. Please refer
+ * to the list of the standard error codes.
+ */
+ERROR_CODE_E msg_queue_send(MSG_QUEUE_T* queue,
+                            void* msg,
+                            const uint32_t timeout);
+
+/**
+ * @brief Receives a message.
+ *
+ * @details Receives the oldest message, the buffer ownership is given to the
+ * caller. If the queue is empty, the caller waits for a message until the 
+ * timeout expires. Interrupt handlers must use a null timeout.
+ *
+ * @param[in, out] queue The queue to receive from.
+ * @param[out] msg The pointer to store the message.
+ * @param[in] timeout The maximal number of ticks to wait, KERNEL_WAIT_FOREVER
+ * to wait without time limit.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_TIMEOUT is returned
+ * if the queue stayed empty. Otherwise an error code is returned. Please 
+ * refer to the list of the standard error codes.
+ */
+ERROR_CODE_E msg_queue_receive(MSG_QUEUE_T* queue,
+                               void** msg,
+                               const uint32_t timeout);
+
+/**
+ * @brief Returns the number of messages stored in a queue.
+ *
+ * @param[in] queue The queue to query.
+ *
+ * @return The number of messages stored in the queue is returned.
+ */
+uint32_t msg_queue_get_count(const MSG_QUEUE_T* queue);
+
+#endif /* #ifndef __CORE_MSG_QUEUE_H__ */
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * @file mutex.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel priority inheritance mutexes.
+ *
+ * @details Kernel priority inheritance mutexes. An uncontended mutex is 
+ * locked and unlocked with a single atomic compare and swap, without system 
+ * call nor interrupt masking. When a task waits for a mutex, the owner 
+ * inherits the waiter priority until it unlocks the mutex, the inheritance is
+ * propagated along the chain of blocked owners. Mutexes can only be used by 
+ * privileged tasks, not by interrupt handlers.
+ ******************************************************************************/
+
+#ifndef __CORE_MUTEX_H__
+#define __CORE_MUTEX_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "scheduler.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Owner flag set when tasks wait for the mutex. */
+#define KERNEL_MUTEX_CONTENDED 0x1
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Kernel mutex. */
+struct KERNEL_MUTEX
+{
+    /** @brief Mutex's name. */
+    const char* name;
+
+    /**
+     * @brief Owner task address, 0 when the mutex is free. The
+     * KERNEL_MUTEX_CONTENDED flag is set when tasks wait for the mutex.
+     */
+    volatile uint32_t owner;
+
+    /** @brief Tasks waiting for the mutex. */
+    KERNEL_WAIT_QUEUE_T waiters;
+
+    /** @brief Next contended mutex held by the same owner. */
+    struct KERNEL_MUTEX* next_held;
+};
+
+/** @brief Short hand for struct KERNEL_MUTEX */
+typedef struct KERNEL_MUTEX KERNEL_MUTEX_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes a mutex.
+ *
+ * @param[out] mutex The mutex to initialize.
+ * @param[in] name The mutex's name.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_mutex_init(KERNEL_MUTEX_T* mutex, const char* name);
+
+/**
+ * @brief Locks a mutex.
+ *
+ * @details Locks a mutex. If the mutex is owned by another task, the caller 
+ * waits until the mutex is unlocked or the timeout expires. The owner 
+ * inherits the caller's priority while the caller waits.
+ *
+ * @param[in, out] mutex The mutex to lock.
+ * @param[in] timeout The maximal number of ticks to wait, KERNEL_WAIT_FOREVER
+ * to wait without time limit.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_TIMEOUT is returned
+ * if the mutex was not unlocked in time. Otherwise an error code is returned.
+ * Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_mutex_lock(KERNEL_MUTEX_T* mutex, const uint32_t timeout);
+
+/**
+ * @brief Unlocks a mutex.
+ *
+ * @details Unlocks a mutex owned by the caller. The ownership is given to the
+ * highest priority waiting task and the caller's inherited priority is 
+ * dropped.
+ *
+ * @param[in, out] mutex The mutex to unlock.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_mutex_unlock(KERNEL_MUTEX_T* mutex);
+
+#endif /* #ifndef __CORE_MUTEX_H__ */
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * @file ready_queue.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel O(1) ready queue.
+ *
+ * @details Kernel O(1) ready queue. The ready queue keeps one FIFO of tasks per
+ * priority level and a bitmap of the non empty levels. The highest priority
+ * ready task is found with a single count leading zeros instruction, whatever
+ * the number of tasks.
+ ******************************************************************************/
+
+#ifndef __CORE_READY_QUEUE_H__
+#define __CORE_READY_QUEUE_H__
+
+#include "stdint.h"
+#include "config.h"
+#include "error_types.h"
+#include "scheduler.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+#if CONFIG_SCHED_PRIORITY_COUNT > 32
+#error CONFIG_SCHED_PRIORITY_COUNT must not exceed 32
+#endif
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Ready queue. */
+struct READY_QUEUE
+{
+    /**
+     * @brief Non empty priority levels bitmap. Priority p is stored in bit
+     * 31 - p, the highest priority ready level is the count of leading zeros.
+     */
+    uint32_t bitmap;
+
+    /** @brief First task of each priority level FIFO. */
+    KERNEL_TASK_T* head[CONFIG_SCHED_PRIORITY_COUNT];
+    /** @brief Last task of each priority level FIFO. */
+    KERNEL_TASK_T* tail[CONFIG_SCHED_PRIORITY_COUNT];
+};
+
+/** @brief Short hand for struct READY_QUEUE */
+typedef struct READY_QUEUE READY_QUEUE_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes a ready queue.
+ *
+ * @details Initializes a ready queue, all the priority levels are emptied.
+ *
+ * @param[out] queue The ready queue to initialize.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E ready_queue_init(READY_QUEUE_T* queue);
+
+/**
+ * @brief Pushes a task in the ready queue.
+ *
+ * @details Pushes a task at the tail of the FIFO of its priority level. This
+ * must be called inside a kernel critical section.
+ *
+ * @param[in, out] queue The ready queue to use.
+ * @param[in] task The task to push.
+ */
+void ready_queue_push(READY_QUEUE_T* queue, KERNEL_TASK_T* task);
+
+/**
+ * @brief Removes the highest priority task from the ready queue.
+ *
+ * @details Removes the first task of the highest priority non empty level.
+ * This must be called inside a kernel critical section.
+ *
+ * @param[in, out] queue The ready queue to use.
+ *
+ * @return The highest priority ready task is returned. NULL is returned if the
+ * queue is empty.
+ */
+KERNEL_TASK_T* ready_queue_pop(READY_QUEUE_T* queue);
+
+/**
+ * @brief Removes a task from the ready queue.
+ *
+ * @details Removes a task from the FIFO of its priority level, wherever it is
+ * in the FIFO. This must be called inside a kernel critical section.
+ *
+ * @param[in, out] queue The ready queue to use.
+ * @param[in] task The task to remove, it must be in the queue.
+ */
+void ready_queue_remove(READY_QUEUE_T* queue, KERNEL_TASK_T* task);
+
+/**
+ * @brief Returns the highest ready priority.
+ *
+ * @details Returns the highest priority level that contains a ready task.
+ *
+ * @param[in] queue The ready queue to use.
+ *
+ * @return The highest ready priority is returned. CONFIG_SCHED_PRIORITY_COUNT
+ * is returned if the queue is empty.
+ */
+uint32_t ready_queue_top_priority(const READY_QUEUE_T* queue);
+
+#endif /* #ifndef __CORE_READY_QUEUE_H__ */
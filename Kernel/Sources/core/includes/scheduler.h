@@ -0,0 +1,413 @@
+/*******************************************************************************
+ * @file scheduler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel preemptive fixed-priority scheduler.
+ *
+ * @details Kernel preemptive fixed-priority scheduler. This module defines the
+ * routines and structures used to create and schedule the kernel tasks. The
+ * highest priority ready task is always elected, tasks sharing the same
+ * priority are scheduled in round-robin on each system tick.
+ ******************************************************************************/
+
+#ifndef __CORE_SCHEDULER_H__
+#define __CORE_SCHEDULER_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "config.h"
+#include "error_types.h"
+#include "cpu_mpu.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Highest priority a task can have. */
+#define KERNEL_HIGHEST_PRIORITY 0
+
+/** @brief Lowest priority a task can have, reserved for the idle task. */
+#define KERNEL_LOWEST_PRIORITY (CONFIG_SCHED_PRIORITY_COUNT - 1)
+
+/** @brief Minimal task stack size in bytes, holds a full FPU context. */
+#define KERNEL_TASK_MIN_STACK_SIZE 256
+
+/** @brief Timeout value used to wait without time limit. */
+#define KERNEL_WAIT_FOREVER UINT32_MAX
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Defines the different states a task can be in. */
+enum KERNEL_TASK_STATE
+{
+    /** @brief The task is in the ready queue, waiting to be elected. */
+    TASK_STATE_READY    = 0,
+    /** @brief The task is the currently elected task. */
+    TASK_STATE_RUNNING  = 1,
+    /** @brief The task is sleeping until its wakeup tick. */
+    TASK_STATE_SLEEPING = 2,
+    /** @brief The task returned from its entry point. */
+    TASK_STATE_DEAD     = 3,
+    /** @brief The task waits on a wait queue, with an optional timeout. */
+    TASK_STATE_WAITING  = 4
+};
+
+/** @brief Short hand for enum KERNEL_TASK_STATE */
+typedef enum KERNEL_TASK_STATE KERNEL_TASK_STATE_T;
+
+/** @brief Kernel mutex, defined by the mutex module. */
+struct KERNEL_MUTEX;
+
+/** @brief Wait queue, the waiting tasks are sorted by priority. */
+struct KERNEL_WAIT_QUEUE
+{
+    /** @brief Highest priority waiting task. */
+    struct KERNEL_TASK* head;
+};
+
+/** @brief Short hand for struct KERNEL_WAIT_QUEUE */
+typedef struct KERNEL_WAIT_QUEUE KERNEL_WAIT_QUEUE_T;
+
+/** @brief Kernel task control block. */
+struct KERNEL_TASK
+{
+    /**
+     * @brief Saved context pointer.
+     *
+     * @warning This field must stay the first of the structure, it is accessed
+     * by the CPU context switch routines.
+     */
+    uintptr_t stack_pointer;
+
+    /**
+     * @brief Stack guard value installed when the task is elected.
+     *
+     * @warning This field must stay the second of the structure, it is
+     * accessed by the CPU context switch routines.
+     */
+    uint32_t stack_guard;
+
+    /**
+     * @brief Stack region installed when the task is elected.
+     *
+     * @warning This field must stay the third of the structure, it is
+     * accessed by the CPU context switch routines.
+     */
+    CPU_MPU_REGION_T stack_region;
+
+    /**
+     * @brief Set to 1 if the task runs unprivileged, 0 otherwise.
+     *
+     * @warning This field must stay the fourth of the structure, it is
+     * accessed by the CPU context switch routines.
+     */
+    uint32_t unprivileged;
+
+    /** @brief Base (lowest) address of the task's stack. */
+    void* stack_base;
+    /** @brief Size of the task's stack in bytes. */
+    size_t stack_size;
+
+    /** @brief Task's priority, 0 being the highest priority. */
+    uint8_t priority;
+    /** @brief Task's priority before priority inheritance. */
+    uint8_t base_priority;
+    /** @brief Task's current state. */
+    KERNEL_TASK_STATE_T state;
+
+    /** @brief Task's name. */
+    const char* name;
+    /** @brief Task's entry point. */
+    void (*entry)(void*);
+    /** @brief Task's entry point argument. */
+    void* args;
+
+    /** @brief Tick at which a sleeping task is woken up. */
+    uint32_t wakeup_tick;
+    /** @brief Number of times the task was elected. */
+    uint32_t switch_count;
+
+    /** @brief Next task in the list the task currently belongs to. */
+    struct KERNEL_TASK* next;
+    /** @brief Previous task in the list the task currently belongs to. */
+    struct KERNEL_TASK* prev;
+
+    /** @brief Wait queue the task is waiting on. */
+    KERNEL_WAIT_QUEUE_T* wait_queue;
+    /** @brief Next task in the wait queue. */
+    struct KERNEL_TASK* wait_next;
+    /** @brief Result of the last wait, set by the waker. */
+    ERROR_CODE_E wait_result;
+    /** @brief Data exchanged with the waker. */
+    uintptr_t wait_data;
+
+    /** @brief Mutex the task is waiting for. */
+    struct KERNEL_MUTEX* blocking_mutex;
+    /** @brief Mutexes held by the task that have waiting tasks. */
+    struct KERNEL_MUTEX* held_mutexes;
+};
+
+/** @brief Short hand for struct KERNEL_TASK */
+typedef struct KERNEL_TASK KERNEL_TASK_T;
+
+/** @brief Scheduler statistics. */
+struct SCHED_STATS
+{
+    /** @brief Number of ticks since the scheduler was initialized. */
+    uint32_t tick_count;
+    /** @brief Number of context switches performed. */
+    uint32_t switch_count;
+    /** @brief CPU cycles between the last tick and the task election. */
+    uint32_t last_latency;
+    /** @brief Maximal CPU cycles between a tick and the task election. */
+    uint32_t max_latency;
+};
+
+/** @brief Short hand for struct SCHED_STATS */
+typedef struct SCHED_STATS SCHED_STATS_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes the scheduler.
+ *
+ * @details Initializes the scheduler and attaches it to the system tick
+ * interrupt. The idle task is created.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E sched_init(void);
+
+/**
+ * @brief Creates a new task.
+ *
+ * @details Creates a new task and adds it to the ready queue. The task control
+ * block and the stack are provided by the caller and must stay valid for the
+ * whole task's life. If the new task has a higher priority than the current
+ * task, it preempts it.
+ *
+ * @param[out] task The task control block to initialize.
+ * @param[in] name The task's name.
+ * @param[in] priority The task's priority, 0 being the highest priority.
+ * @param[in] entry The task's entry point.
+ * @param[in] args The argument given to the task's entry point.
+ * @param[in] stack The base address of the task's stack.
+ * @param[in] stack_size The size in bytes of the task's stack.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E sched_create_task(KERNEL_TASK_T* task,
+                               const char* name,
+                               const uint8_t priority,
+                               void (*entry)(void*),
+                               void* args,
+                               void* stack,
+                               const size_t stack_size);
+
+/**
+ * @brief Creates a new unprivileged task.
+ *
+ * @details Creates a new unprivileged task and adds it to the ready queue. The
+ * task runs on its own stack and can only access the flash, the user data 
+ * region and its stack. It enters the kernel through system calls only. The
+ * stack size must be a power of two and the stack must be aligned on its 
+ * size. If the new task has a higher priority than the current task, it 
+ * preempts it.
+ *
+ * @param[out] task The task control block to initialize.
+ * @param[in] name The task's name.
+ * @param[in] priority The task's priority, 0 being the highest priority.
+ * @param[in] entry The task's entry point.
+ * @param[in] args The argument given to the task's entry point.
+ * @param[in] stack The base address of the task's stack.
+ * @param[in] stack_size The size in bytes of the task's stack.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E sched_create_user_task(KERNEL_TASK_T* task,
+                                    const char* name,
+                                    const uint8_t priority,
+                                    void (*entry)(void*),
+                                    void* args,
+                                    void* stack,
+                                    const size_t stack_size);
+
+/**
+ * @brief Starts the scheduler.
+ *
+ * @details Starts the scheduler, the highest priority ready task is elected
+ * and its context is restored.
+ *
+ * @warning This function never returns.
+ */
+void sched_start(void) __attribute__((__noreturn__));
+
+/**
+ * @brief Yields the CPU.
+ *
+ * @details Yields the CPU, the current task is put back in the ready queue and
+ * the highest priority ready task is elected.
+ */
+void sched_yield(void);
+
+/**
+ * @brief Puts the current task to sleep.
+ *
+ * @details Puts the current task to sleep for the number of ticks given as
+ * parameter. The task is put back in the ready queue once the ticks elapsed.
+ *
+ * @param[in] ticks The number of system ticks to sleep.
+ */
+void sched_sleep(const uint32_t ticks);
+
+/**
+ * @brief Initializes a wait queue.
+ *
+ * @param[out] queue The wait queue to initialize.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E sched_wait_queue_init(KERNEL_WAIT_QUEUE_T* queue);
+
+/**
+ * @brief Blocks the current task on a wait queue.
+ *
+ * @details Blocks the current task on a wait queue until it is woken up or
+ * the timeout expires. This must be called inside a kernel critical section 
+ * which is exited by this function, the context switch happens on exit. The 
+ * critical section must not be nested.
+ *
+ * @param[in, out] queue The wait queue to wait on.
+ * @param[in] timeout The maximal number of ticks to wait, KERNEL_WAIT_FOREVER
+ * to wait without time limit.
+ * @param[in] int_state The interrupt state returned when entering the 
+ * critical section.
+ *
+ * @return The result given by the waker is returned. ERROR_TIMEOUT is 
+ * returned if the timeout expired. ERROR_NOT_AVAILABLE is returned if called
+ * from an interrupt handler or before the scheduler is started.
+ */
+ERROR_CODE_E sched_wait(KERNEL_WAIT_QUEUE_T* queue,
+                        const uint32_t timeout,
+                        const uint32_t int_state);
+
+/**
+ * @brief Blocks the current task on a wait queue with data for the waker.
+ *
+ * @details Same as sched_wait, the data is stored in the task wait_data only
+ * once the task blocks. When the call returns immediately, the wait_data of
+ * the current task is left untouched.
+ *
+ * @param[in, out] queue The wait queue to wait on.
+ * @param[in] timeout The maximal number of ticks to wait, KERNEL_WAIT_FOREVER
+ * to wait without time limit.
+ * @param[in] wait_data The data exchanged with the waker.
+ * @param[in] int_state The interrupt state returned when entering the 
+ * critical section.
+ *
+ * @return The result given by the waker is returned. ERROR_TIMEOUT is 
+ * returned if the timeout expired. ERROR_NOT_AVAILABLE is returned if called
+ * from an interrupt handler or before the scheduler is started.
+ */
+ERROR_CODE_E sched_wait_data(KERNEL_WAIT_QUEUE_T* queue,
+                             const uint32_t timeout,
+                             const uintptr_t wait_data,
+                             const uint32_t int_state);
+
+/**
+ * @brief Wakes up a waiting task.
+ *
+ * @details Wakes up a waiting task, the task is removed from its wait queue 
+ * and put back in the ready queue. If the task has a higher priority than the
+ * current task, it preempts it once the critical section is exited. This must
+ * be called inside a kernel critical section, from a task or an interrupt
+ * handler.
+ *
+ * @param[in, out] task The task to wake up.
+ * @param[in] result The result returned to the task by sched_wait.
+ */
+void sched_wake_task(KERNEL_TASK_T* task, const ERROR_CODE_E result);
+
+/**
+ * @brief Wakes up the highest priority task of a wait queue.
+ *
+ * @details Wakes up the highest priority task of a wait queue, see 
+ * sched_wake_task. This must be called inside a kernel critical section.
+ *
+ * @param[in, out] queue The wait queue to wake.
+ * @param[in] result The result returned to the task by sched_wait.
+ *
+ * @return The woken up task is returned, NULL if no task was waiting.
+ */
+KERNEL_TASK_T* sched_wake_one(KERNEL_WAIT_QUEUE_T* queue, 
+                              const ERROR_CODE_E result);
+
+/**
+ * @brief Sets the effective priority of a task.
+ *
+ * @details Sets the effective priority of a task, used by priority 
+ * inheritance. The task is moved in the ready queue or in its wait queue 
+ * according to its new priority. If a ready task gets a higher priority than
+ * the current task, it preempts it once the critical section is exited. This
+ * must be called inside a kernel critical section.
+ *
+ * @param[in, out] task The task to update.
+ * @param[in] priority The new effective priority.
+ */
+void sched_set_priority(KERNEL_TASK_T* task, const uint8_t priority);
+
+/**
+ * @brief Terminates the current task.
+ *
+ * @details Terminates the current task, the task is marked as dead and never
+ * elected again. Its context is not saved.
+ */
+void sched_exit(void);
+
+/**
+ * @brief Returns the currently elected task.
+ *
+ * @details Returns the currently elected task. NULL is returned if the
+ * scheduler is not started.
+ *
+ * @return The currently elected task is returned.
+ */
+KERNEL_TASK_T* sched_get_current_task(void);
+
+/**
+ * @brief Returns the system tick count.
+ *
+ * @details Returns the number of system ticks since the scheduler was
+ * initialized.
+ *
+ * @return The system tick count is returned.
+ */
+uint32_t sched_get_tick(void);
+
+/**
+ * @brief Gets the scheduler statistics.
+ *
+ * @details Gets the scheduler statistics: tick count, context switch count and
+ * scheduling latency expressed in CPU cycles.
+ *
+ * @param[out] stats The buffer to receive the statistics.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E sched_get_stats(SCHED_STATS_T* stats);
+
+#endif /* #ifndef __CORE_SCHEDULER_H__ */
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * @file semaphore.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel counting semaphores.
+ *
+ * @details Kernel counting semaphores. When the semaphore has units available
+ * and no task waits, taking and giving a unit is done with a single atomic 
+ * compare and swap, without system call nor interrupt masking. Interrupt 
+ * handlers can give units and take units with a null timeout.
+ ******************************************************************************/
+
+#ifndef __CORE_SEMAPHORE_H__
+#define __CORE_SEMAPHORE_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "scheduler.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Kernel counting semaphore. */
+struct KERNEL_SEMAPHORE
+{
+    /** @brief Semaphore's name. */
+    const char* name;
+
+    /**
+     * @brief Number of available units. When negative, its opposite is the 
+     * number of waiting tasks.
+     */
+    volatile int32_t count;
+
+    /** @brief Tasks waiting for a unit. */
+    KERNEL_WAIT_QUEUE_T waiters;
+};
+
+/** @brief Short hand for struct KERNEL_SEMAPHORE */
+typedef struct KERNEL_SEMAPHORE KERNEL_SEMAPHORE_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes a semaphore.
+ *
+ * @param[out] sem The semaphore to initialize.
+ * @param[in] name The semaphore's name.
+ * @param[in] count The initial number of available units.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_sem_init(KERNEL_SEMAPHORE_T* sem, 
+                             const char* name,
+                             const int32_t count);
+
+/**
+ * @brief Takes a semaphore unit.
+ *
+ * @details Takes a semaphore unit. If no unit is available, the caller waits
+ * until a unit is given or the timeout expires. Interrupt handlers must use a
+ * null timeout.
+ *
+ * @param[in, out] sem The semaphore to take.
+ * @param[in] timeout The maximal number of ticks to wait, KERNEL_WAIT_FOREVER
+ * to wait without time limit.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_TIMEOUT is returned
+ * if no unit was given in time. Otherwise an error code is returned. Please 
+ * refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_sem_take(KERNEL_SEMAPHORE_T* sem, const uint32_t timeout);
+
+/**
+ * @brief Gives a semaphore unit.
+ *
+ * @details Gives a semaphore unit. If tasks wait, the unit is given to the 
+ * highest priority waiting task.
+ *
+ * @param[in, out] sem The semaphore to give.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_sem_give(KERNEL_SEMAPHORE_T* sem);
+
+#endif /* #ifndef __CORE_SEMAPHORE_H__ */
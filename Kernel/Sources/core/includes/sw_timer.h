@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * @file sw_timer.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel software timers.
+ *
+ * @details Kernel software timers. The timers are kept in a hierarchical 
+ * timing wheel driven by the system tick. Starting and stopping a timer is 
+ * done in constant time and the tick processing does not depend on the number
+ * of armed timers. The timers callbacks are executed in the system tick 
+ * interrupt handler.
+ ******************************************************************************/
+
+#ifndef __CORE_SW_TIMER_H__
+#define __CORE_SW_TIMER_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Number of bits of the tick count managed by each wheel level. */
+#define SW_TIMER_WHEEL_BITS 6
+
+/** @brief Number of slots per wheel level. */
+#define SW_TIMER_WHEEL_SLOTS (1U << SW_TIMER_WHEEL_BITS)
+
+/** @brief Number of wheel levels. */
+#define SW_TIMER_WHEEL_LEVELS 4
+
+/**
+ * @brief Longest delay in ticks the wheel can hold, longer timers are 
+ * re-cascaded until they expire.
+ */
+#define SW_TIMER_WHEEL_RANGE \
+    (1U << (SW_TIMER_WHEEL_BITS * SW_TIMER_WHEEL_LEVELS))
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Kernel software timer. */
+struct KERNEL_TIMER
+{
+    /** @brief Next timer in the wheel slot. */
+    struct KERNEL_TIMER* next;
+    /** @brief Link pointing to this timer in the wheel slot, NULL if idle. */
+    struct KERNEL_TIMER** pprev;
+
+    /** @brief Tick at which the timer expires. */
+    uint32_t expiry;
+    /** @brief Reload period in ticks, 0 for a one-shot timer. */
+    uint32_t period;
+
+    /** @brief Wheel level holding the timer. */
+    uint8_t level;
+    /** @brief Wheel slot holding the timer. */
+    uint8_t slot;
+
+    /** @brief Timer's name. */
+    const char* name;
+
+    /** @brief Routine called when the timer expires. */
+    void (*callback)(void*);
+    /** @brief Argument given to the callback. */
+    void* args;
+};
+
+/** @brief Short hand for struct KERNEL_TIMER */
+typedef struct KERNEL_TIMER KERNEL_TIMER_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes the software timers wheel.
+ *
+ * @details Initializes the software timers wheel, all the slots are emptied.
+ *
+ * @param[in] tick The current system tick count.
+ *
+ * @warning This function is called by the scheduler initialization and should
+ * not be called elsewhere.
+ */
+void kernel_timer_wheel_init(const uint32_t tick);
+
+/**
+ * @brief Initializes a software timer.
+ *
+ * @details Initializes a software timer. The timer memory is provided by the
+ * caller and must stay valid while the timer is armed.
+ *
+ * @param[out] timer The timer to initialize.
+ * @param[in] name The timer's name.
+ * @param[in] callback The routine called when the timer expires.
+ * @param[in] args The argument given to the callback.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_timer_init(KERNEL_TIMER_T* timer,
+                               const char* name,
+                               void (*callback)(void*),
+                               void* args);
+
+/**
+ * @brief Starts a software timer.
+ *
+ * @details Starts a software timer in constant time. If the timer is already
+ * armed, it is restarted. The callback is executed in the system tick 
+ * interrupt handler and must be short, longer work should be deferred to a 
+ * task.
+ *
+ * @param[in, out] timer The timer to start.
+ * @param[in] delay The number of ticks before the first expiration, at least 1.
+ * @param[in] period The reload period in ticks, 0 for a one-shot timer.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_timer_start(KERNEL_TIMER_T* timer,
+                                const uint32_t delay,
+                                const uint32_t period);
+
+/**
+ * @brief Stops a software timer.
+ *
+ * @details Stops a software timer in constant time. Stopping an idle timer has
+ * no effect.
+ *
+ * @param[in, out] timer The timer to stop.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E kernel_timer_stop(KERNEL_TIMER_T* timer);
+
+/**
+ * @brief Tells if a software timer is armed.
+ *
+ * @param[in] timer The timer to check.
+ *
+ * @return 1 is returned if the timer is armed, 0 otherwise.
+ */
+uint32_t kernel_timer_is_active(const KERNEL_TIMER_T* timer);
+
+/**
+ * @brief Processes the software timers up to the current tick.
+ *
+ * @details Advances the wheel up to the given tick, cascades the higher levels
+ * and executes the callbacks of the expired timers. Ticks missed while the
+ * system ticks were suppressed are caught up.
+ *
+ * @param[in] tick The current system tick count.
+ *
+ * @warning This function is called by the system tick interrupt handler and 
+ * should not be called elsewhere.
+ */
+void kernel_timer_process(const uint32_t tick);
+
+/**
+ * @brief Returns the number of ticks until the next timer deadline.
+ *
+ * @details Returns the number of ticks until the wheel needs to be processed.
+ * The value is exact for the timers expiring in the current level 0 rotation,
+ * otherwise the next cascade is returned. This must be called inside a kernel
+ * critical section.
+ *
+ * @param[in] tick The current system tick count.
+ *
+ * @return The number of ticks until the next deadline is returned. UINT32_MAX
+ * is returned if no timer is armed.
+ */
+uint32_t kernel_timer_get_idle_ticks(const uint32_t tick);
+
+#endif /* #ifndef __CORE_SW_TIMER_H__ */
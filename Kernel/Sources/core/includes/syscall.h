@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * @file syscall.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel system calls.
+ *
+ * @details Kernel system calls. System calls are raised with the SVC
+ * instruction, the call identifier is the instruction immediate and the 
+ * arguments are passed in r0-r3. The SVC handler reads the arguments from the
+ * stacked exception frame and jumps to the kernel routine through a table 
+ * indexed by the call identifier. The returned value is written back in the 
+ * stacked r0.
+ *
+ * @warning System calls must not be raised from an interrupt handler or inside
+ * a kernel critical section, the SVC exception would escalate to a hard fault.
+ ******************************************************************************/
+
+#ifndef __CORE_SYSCALL_H__
+#define __CORE_SYSCALL_H__
+
+#include "stdint.h"
+#include "error_types.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/**
+ * @brief System calls identifiers.
+ *
+ * @warning This list must be kept in sync with syscall.inc.
+ */
+enum SYSCALL_ID
+{
+    /** @brief Yields the CPU. */
+    SYSCALL_YIELD    = 0,
+    /** @brief Puts the calling task to sleep. */
+    SYSCALL_SLEEP    = 1,
+    /** @brief Returns the system tick count. */
+    SYSCALL_GET_TICK = 2,
+    /** @brief Terminates the calling task. */
+    SYSCALL_EXIT     = 3,
+
+    /** @brief Number of system calls. */
+    SYSCALL_COUNT
+};
+
+/** @brief Short hand for enum SYSCALL_ID */
+typedef enum SYSCALL_ID SYSCALL_ID_T;
+
+/**
+ * @brief System call kernel routine, receives the caller r0-r3 registers.
+ *
+ * @details System call kernel routine, receives the caller r0-r3 registers
+ * and returns the value given back to the caller in r0.
+ */
+typedef uint32_t (*SYSCALL_HANDLER_T)(const uint32_t,
+                                      const uint32_t,
+                                      const uint32_t,
+                                      const uint32_t);
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Kernel system calls jump table, indexed by system call identifier.
+ *
+ * @details Kernel system calls jump table, indexed by system call identifier.
+ * The table is used by the CPU SVC handler and must not be static.
+ */
+extern const SYSCALL_HANDLER_T kernel_syscall_table[SYSCALL_COUNT];
+
+/**
+ * @brief Yields the CPU through a system call.
+ *
+ * @details Yields the CPU through a system call, the highest priority ready 
+ * task is elected.
+ */
+void sys_yield(void);
+
+/**
+ * @brief Puts the calling task to sleep through a system call.
+ *
+ * @details Puts the calling task to sleep for the number of ticks given as
+ * parameter through a system call.
+ *
+ * @param[in] ticks The number of system ticks to sleep.
+ */
+void sys_sleep(const uint32_t ticks);
+
+/**
+ * @brief Returns the system tick count through a system call.
+ *
+ * @details Returns the number of system ticks since the scheduler was 
+ * initialized through a system call.
+ *
+ * @return The system tick count is returned.
+ */
+uint32_t sys_get_tick(void);
+
+/**
+ * @brief Terminates the calling task through a system call.
+ *
+ * @details Terminates the calling task through a system call. This is the 
+ * exit point of the unprivileged tasks.
+ *
+ * @warning This function never returns.
+ */
+void sys_exit(void) __attribute__((__noreturn__));
+
+#endif /* #ifndef __CORE_SYSCALL_H__ */
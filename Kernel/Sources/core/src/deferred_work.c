@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * @file deferred_work.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel deferred interrupt work.
+ *
+ * @details Kernel deferred interrupt work. The queue is a lock-free stack
+ * updated with atomic compare and swap operations. The whole stack is detached
+ * at once when drained and reversed to process the items in posting order.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "cpu_atomic.h"
+#include "deferred_work.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/**
+ * @brief Deferred work queue head.
+ *
+ * @details Deferred work queue head, last posted item first. This variable is
+ * checked by the pending service exception handler and must not be static.
+ */
+KERNEL_DEFERRED_WORK_T* volatile kernel_deferred_work_head = NULL;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E kernel_deferred_work_init(KERNEL_DEFERRED_WORK_T* work,
+                                       void (*routine)(void*),
+                                       void* args)
+{
+    if(work == NULL || routine == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    work->next    = NULL;
+    work->routine = routine;
+    work->args    = args;
+    work->pending = 0;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kernel_deferred_work_post(KERNEL_DEFERRED_WORK_T* work)
+{
+    KERNEL_DEFERRED_WORK_T* head;
+
+    if(work == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    /* Already queued, the routine will be executed once */
+    if(cpu_atomic_cas(&work->pending, 0, 1) != 0)
+    {
+        return NO_ERROR;
+    }
+
+    do
+    {
+        head       = kernel_deferred_work_head;
+        work->next = head;
+    } while(cpu_atomic_cas((volatile uint32_t*)&kernel_deferred_work_head,
+                           (uint32_t)head,
+                           (uint32_t)work) != (uint32_t)head);
+
+    cpu_raise_pending_service();
+
+    return NO_ERROR;
+}
+
+void kernel_deferred_work_drain(void)
+{
+    KERNEL_DEFERRED_WORK_T* list;
+    KERNEL_DEFERRED_WORK_T* ordered;
+    KERNEL_DEFERRED_WORK_T* work;
+
+    /* Detach the whole queue */
+    list = (KERNEL_DEFERRED_WORK_T*)
+           cpu_atomic_swap((volatile uint32_t*)&kernel_deferred_work_head, 0);
+
+    /* Reverse the list to get the posting order */
+    ordered = NULL;
+    while(list != NULL)
+    {
+        work       = list;
+        list       = work->next;
+        work->next = ordered;
+        ordered    = work;
+    }
+
+    while(ordered != NULL)
+    {
+        work    = ordered;
+        ordered = work->next;
+
+        /* The routine can post the item again */
+        work->next    = NULL;
+        work->pending = 0;
+        work->routine(work->args);
+    }
+}
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * @file event_group.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel event flag groups.
+ *
+ * @details Kernel event flag groups. A waiting task stores its wait request on
+ * its stack and links it to its wait data. Setting flags checks each waiter 
+ * request inside a single kernel critical section, so that the waiters 
+ * observe the same flags, and wakes the satisfied ones directly.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "scheduler.h"
+#include "event_group.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Wait request of a task waiting on an event group. */
+struct KERNEL_EVENT_REQUEST
+{
+    /** @brief Flags waited for. */
+    uint32_t mask;
+    /** @brief Wait options. */
+    uint32_t options;
+    /** @brief Flags that satisfied the wait. */
+    uint32_t flags;
+};
+
+/** @brief Short hand for struct KERNEL_EVENT_REQUEST */
+typedef struct KERNEL_EVENT_REQUEST KERNEL_EVENT_REQUEST_T;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Tells if a wait condition is satisfied.
+ *
+ * @param[in] flags The current event flags.
+ * @param[in] mask The flags waited for.
+ * @param[in] options The wait options.
+ *
+ * @return 1 is returned if the condition is satisfied, 0 otherwise.
+ */
+static uint32_t kernel_event_satisfied(const uint32_t flags, 
+                                       const uint32_t mask,
+                                       const uint32_t options)
+{
+    if((options & KERNEL_EVENT_WAIT_ALL) != 0)
+    {
+        return ((flags & mask) == mask) ? 1 : 0;
+    }
+
+    return ((flags & mask) != 0) ? 1 : 0;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E kernel_event_init(KERNEL_EVENT_GROUP_T* group, const char* name)
+{
+    if(group == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    group->name  = name;
+    group->flags = 0;
+
+    return sched_wait_queue_init(&group->waiters);
+}
+
+ERROR_CODE_E kernel_event_set(KERNEL_EVENT_GROUP_T* group, 
+                              const uint32_t flags)
+{
+    KERNEL_TASK_T*          task;
+    KERNEL_TASK_T*          next;
+    KERNEL_EVENT_REQUEST_T* request;
+    uint32_t                clear;
+    uint32_t                int_state;
+
+    if(group == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+
+    group->flags |= flags;
+
+    /* Wake all the satisfied waiters, in priority order */
+    clear = 0;
+    for(task = group->waiters.head; task != NULL; task = next)
+    {
+        next    = task->wait_next;
+        request = (KERNEL_EVENT_REQUEST_T*)task->wait_data;
+
+        if(kernel_event_satisfied(group->flags, 
+                                  request->mask, 
+                                  request->options) != 0)
+        {
+            request->flags = group->flags;
+            if((request->options & KERNEL_EVENT_CLEAR) != 0)
+            {
+                clear |= request->mask;
+            }
+            sched_wake_task(task, NO_ERROR);
+        }
+    }
+    group->flags &= ~clear;
+
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kernel_event_clear(KERNEL_EVENT_GROUP_T* group, 
+                                const uint32_t flags)
+{
+    uint32_t int_state;
+
+    if(group == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+    group->flags &= ~flags;
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+uint32_t kernel_event_get(const KERNEL_EVENT_GROUP_T* group)
+{
+    if(group == NULL)
+    {
+        return 0;
+    }
+
+    return group->flags;
+}
+
+ERROR_CODE_E kernel_event_wait(KERNEL_EVENT_GROUP_T* group,
+                               const uint32_t mask,
+                               const uint32_t options,
+                               const uint32_t timeout,
+                               uint32_t* flags)
+{
+    KERNEL_EVENT_REQUEST_T request;
+    uint32_t               int_state;
+    ERROR_CODE_E           error;
+
+    if(group == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(mask == 0)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+
+    int_state = cpu_enter_critical();
+
+    /* The condition is already satisfied */
+    if(kernel_event_satisfied(group->flags, mask, options) != 0)
+    {
+        if(flags != NULL)
+        {
+            *flags = group->flags;
+        }
+        if((options & KERNEL_EVENT_CLEAR) != 0)
+        {
+            group->flags &= ~mask;
+        }
+
+        cpu_exit_critical(int_state);
+        return NO_ERROR;
+    }
+
+    /* Wait for a setter to satisfy the request */
+    request.mask    = mask;
+    request.options = options;
+    request.flags   = 0;
+
+    /* The request is only published to the setters once the task blocks */
+    error = sched_wait_data(&group->waiters, 
+                            timeout, 
+                            (uintptr_t)&request, 
+                            int_state);
+    if(error == NO_ERROR && flags != NULL)
+    {
+        *flags = request.flags;
+    }
+
+    return error;
+}
@@ -14,23 +14,56 @@
  * provides routine to setup the processor and bootstrap the kernel.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
 #include "stdint.h"
 #include "config.h"
 #include "interrupts.h"
 #include "panic.h"
 #include "error_types.h"
 #include "logger.h"
+#include "cpu_interrupt.h"
 
 /*******************************************************************************
  * Private data
  ******************************************************************************/
 
-static KERNEL_INT_HANDLER_T handlers[CONFIG_MAX_INTERRUPT_LINES] = {{NULL}};
+/** @brief Number of interrupt IDs: CPU exceptions and external lines. */
+#define KERNEL_INT_ID_COUNT (INT_EXT_FIRST_ID + CONFIG_MAX_INTERRUPT_LINES)
+
+/** @brief Kernel interrupt handlers table, indexed by interrupt ID. */
+static KERNEL_INT_HANDLER_T handlers[KERNEL_INT_ID_COUNT] = {{NULL}};
+
+/** @brief Set for the interrupts routed to a directly installed ISR. */
+static uint8_t isr_installed[KERNEL_INT_ID_COUNT] = {0};
 
 /*******************************************************************************
  * Private functions
  ******************************************************************************/
 
+/**
+ * @brief Tells if an interrupt vector is reserved by the kernel.
+ * 
+ * @details The faults, system call and pending service vectors are always 
+ * routed to the kernel, they cannot receive a directly installed ISR.
+ * 
+ * @param[in] int_number The interrupt identifier to check.
+ * 
+ * @return 1 is returned if the vector is reserved, 0 otherwise.
+ */
+static uint32_t kernel_interrupt_is_reserved(const INTERRUPT_ID_T int_number)
+{
+    switch(int_number)
+    {
+        case INT_NMI_ID:
+        case INT_DEBUG_ID:
+        case INT_SYS_TICK_ID:
+            return 0;
+        default:
+            return (int_number < INT_EXT_FIRST_ID) ? 1 : 0;
+    }
+}
+
 /*******************************************************************************
  * Public functions
  ******************************************************************************/
@@ -39,10 +72,7 @@ void kernel_global_interrupt_handler(const INTERRUPT_ID_T int_number,
                                      const uintptr_t stack, 
                                      const uintptr_t cpu_state)
 {
-    (void)stack;
-    (void)cpu_state;
-
-    if(int_number > CONFIG_MAX_INTERRUPT_LINES ||
+    if(int_number >= KERNEL_INT_ID_COUNT ||
        handlers[int_number].handler == NULL)
     {
         KERNEL_LOG_ERROR("Unkown interrupt ID", 
@@ -52,4 +82,132 @@ void kernel_global_interrupt_handler(const INTERRUPT_ID_T int_number,
         kernel_panic(ERROR_UNKNOWN_INT);
     }
 
+    handlers[int_number].handler(int_number, stack, cpu_state);
+}
+
+ERROR_CODE_E kernel_interrupt_init(void)
+{
+    ERROR_CODE_E error;
+
+    error = cpu_interrupt_init_vector();
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    KERNEL_LOG_INFO("Interrupt vector relocated", NULL, 0, NO_ERROR);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kernel_interrupt_register_handler(const INTERRUPT_ID_T int_number,
+                                               void (*handler)(
+                                                   const INTERRUPT_ID_T,
+                                                   const uintptr_t,
+                                                   const uintptr_t))
+{
+    if(int_number >= KERNEL_INT_ID_COUNT)
+    {
+        KERNEL_LOG_ERROR("Interrupt ID out of bound", 
+                         (void*)&int_number, 
+                         sizeof(int_number),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+    if(handler == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(handlers[int_number].handler != NULL || 
+       isr_installed[int_number] != 0)
+    {
+        KERNEL_LOG_ERROR("Interrupt handler already registered", 
+                         (void*)&int_number, 
+                         sizeof(int_number),
+                         ERROR_ALREADY_INIT);
+        return ERROR_ALREADY_INIT;
+    }
+
+    handlers[int_number].handler = handler;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kernel_interrupt_remove_handler(const INTERRUPT_ID_T int_number)
+{
+    if(int_number >= KERNEL_INT_ID_COUNT)
+    {
+        KERNEL_LOG_ERROR("Interrupt ID out of bound", 
+                         (void*)&int_number, 
+                         sizeof(int_number),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    handlers[int_number].handler = NULL;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kernel_interrupt_set_isr(const INTERRUPT_ID_T int_number,
+                                      void (*isr)(void))
+{
+    ERROR_CODE_E error;
+
+    if(int_number >= KERNEL_INT_ID_COUNT)
+    {
+        KERNEL_LOG_ERROR("Interrupt ID out of bound", 
+                         (void*)&int_number, 
+                         sizeof(int_number),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+    if(kernel_interrupt_is_reserved(int_number) != 0)
+    {
+        KERNEL_LOG_ERROR("Cannot override a kernel reserved vector", 
+                         (void*)&int_number, 
+                         sizeof(int_number),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+    if(handlers[int_number].handler != NULL || 
+       isr_installed[int_number] != 0)
+    {
+        KERNEL_LOG_ERROR("Interrupt handler already registered", 
+                         (void*)&int_number, 
+                         sizeof(int_number),
+                         ERROR_ALREADY_INIT);
+        return ERROR_ALREADY_INIT;
+    }
+
+    error = cpu_interrupt_set_vector(int_number, isr);
+    if(error == NO_ERROR)
+    {
+        isr_installed[int_number] = 1;
+    }
+
+    return error;
+}
+
+ERROR_CODE_E kernel_interrupt_remove_isr(const INTERRUPT_ID_T int_number)
+{
+    ERROR_CODE_E error;
+
+    if(int_number >= KERNEL_INT_ID_COUNT ||
+       kernel_interrupt_is_reserved(int_number) != 0)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+    if(isr_installed[int_number] == 0)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    error = cpu_interrupt_restore_vector(int_number);
+    if(error == NO_ERROR)
+    {
+        isr_installed[int_number] = 0;
+    }
+
+    return error;
 }
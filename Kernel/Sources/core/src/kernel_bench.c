@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * @file kernel_bench.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel boot benchmarks.
+ *
+ * @details Kernel boot benchmarks. The benchmark task is privileged as the
+ * cycle counter is not accessible to the unprivileged tasks, the system calls
+ * take the same path from both modes. The system tick can interrupt a
+ * measurement, the minimum and the mean are the relevant values.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
+#include "stdint.h"
+#include "stddef.h"
+#include "config.h"
+#include "error_types.h"
+#include "cpu_profile.h"
+#include "scheduler.h"
+#include "syscall.h"
+#include "kernel_bench.h"
+
+#if CONFIG_KERNEL_BENCH_ENABLED == 1
+
+#if CONFIG_CPU_PROFILE_ENABLED != 1
+#error "CONFIG_KERNEL_BENCH_ENABLED requires CONFIG_CPU_PROFILE_ENABLED"
+#endif
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Benchmark task stack size in bytes (power of two). */
+#define KERNEL_BENCH_STACK_SIZE 512
+
+/** @brief Benchmark task control block. */
+static KERNEL_TASK_T bench_task;
+
+/** @brief Benchmark task stack, aligned on its size for the MPU. */
+static uint32_t bench_stack[KERNEL_BENCH_STACK_SIZE / sizeof(uint32_t)]
+    __attribute__((aligned(KERNEL_BENCH_STACK_SIZE)));
+
+/** @brief Context switch peer task control block. */
+static KERNEL_TASK_T bench_peer_task;
+
+/** @brief Context switch peer task stack, aligned on its size for the MPU. */
+static uint32_t bench_peer_stack[KERNEL_BENCH_STACK_SIZE / sizeof(uint32_t)]
+    __attribute__((aligned(KERNEL_BENCH_STACK_SIZE)));
+
+/** @brief Set when the context switch peer task must exit. */
+static volatile uint32_t bench_peer_done;
+
+/** @brief System call round trip probe. */
+static CPU_PROFILE_PROBE_T bench_syscall_probe;
+
+/** @brief Yield context switch probe. */
+static CPU_PROFILE_PROBE_T bench_switch_probe;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Measures the system call round trip.
+ *
+ * @details Measures the SYSCALL_GET_TICK system call, from the SVC
+ * instruction to the return in the caller. The kernel routine only reads the
+ * tick count, the measurement is the system call entry and exit cost.
+ */
+static void kernel_bench_syscall(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < CONFIG_KERNEL_BENCH_ITERATIONS; ++i)
+    {
+        CPU_PROFILE_BEGIN(&bench_syscall_probe);
+        (void)sys_get_tick();
+        CPU_PROFILE_END(&bench_syscall_probe);
+    }
+}
+
+/**
+ * @brief Context switch peer task routine.
+ *
+ * @details Ends the measurement started by the benchmark task before its 
+ * yield, then yields back, until the benchmark is done.
+ *
+ * @param[in] args Unused.
+ */
+static void kernel_bench_peer_entry(void* args)
+{
+    (void)args;
+
+    while(bench_peer_done == 0)
+    {
+        CPU_PROFILE_END(&bench_switch_probe);
+        sys_yield();
+    }
+}
+
+/**
+ * @brief Measures the context switch.
+ *
+ * @details Measures the yield from the benchmark task to the peer task, of 
+ * the same priority, from the SVC instruction to the resume of the peer. The
+ * measurement is the system call entry, the election, the PendSV context 
+ * switch and the exception return: the system call round trip gives the part
+ * of the system call.
+ */
+static void kernel_bench_switch(void)
+{
+    uint32_t i;
+
+    bench_peer_done = 0;
+    if(sched_create_task(&bench_peer_task, "bench_peer",
+                         KERNEL_HIGHEST_PRIORITY,
+                         kernel_bench_peer_entry, NULL,
+                         bench_peer_stack, sizeof(bench_peer_stack)) !=
+       NO_ERROR)
+    {
+        return;
+    }
+
+    for(i = 0; i < CONFIG_KERNEL_BENCH_ITERATIONS; ++i)
+    {
+        CPU_PROFILE_BEGIN(&bench_switch_probe);
+        sys_yield();
+    }
+
+    /* Let the peer task exit */
+    bench_peer_done = 1;
+    sys_yield();
+}
+
+/**
+ * @brief Benchmark task routine.
+ *
+ * @param[in] args Unused.
+ */
+static void kernel_bench_entry(void* args)
+{
+    (void)args;
+
+    kernel_bench_syscall();
+    kernel_bench_switch();
+
+    cpu_profile_dump_all();
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E kernel_bench_start(void)
+{
+    ERROR_CODE_E error;
+
+    error = cpu_profile_probe_init(&bench_syscall_probe,
+                                   "Syscall round trip");
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+    error = cpu_profile_probe_init(&bench_switch_probe, "Yield switch");
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    return sched_create_task(&bench_task, "bench",
+                             KERNEL_HIGHEST_PRIORITY,
+                             kernel_bench_entry, NULL,
+                             bench_stack, sizeof(bench_stack));
+}
+
+#endif /* #if CONFIG_KERNEL_BENCH_ENABLED == 1 */
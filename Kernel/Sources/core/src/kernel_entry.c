@@ -13,6 +13,8 @@
  * provides routine to setup the processor and bootstrap the kernel.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
 #include "error_types.h"
 #include "config.h"
 #include "serial.h"
@@ -20,20 +22,48 @@
 #include "bsp_logger.h"
 #include "panic.h"
 #include "cpu_timer.h"
+#include "scheduler.h"
+#include "interrupts.h"
+#include "kheap.h"
+#include "cpu_mpu.h"
+#include "cpu_profile.h"
+#include "crash_log.h"
+#include "kernel_bench.h"
 
 /*******************************************************************************
  * Private data
  ******************************************************************************/
 
+/** @brief Main task control block. */
+static KERNEL_TASK_T main_task;
+
+/** @brief Main task stack, aligned on its size for the memory protection. */
+static uint32_t main_stack[CONFIG_MAIN_TASK_STACK_SIZE / sizeof(uint32_t)]
+    __attribute__((aligned(CONFIG_MAIN_TASK_STACK_SIZE)));
+
 /*******************************************************************************
  * Private functions
  ******************************************************************************/
 
+/** @brief User's application entry point, defined in the user module. */
+int user_main(void);
+
 static void early_init(void)
 {
     ERROR_CODE_E      error;
     SERIAL_SETTINGS_T ser_settings = CONFIG_UART_SETTINGS;
     LOGGER_SETTINGS_T log_settings = {bsp_logger_write_hook};
+#if CONFIG_CRASH_LOG_ENABLED == 1
+    CRASH_LOG_PANIC_T panic;
+
+    /* Before the first log, the previous run crash log is kept if any */
+    (void)crash_log_init();
+#endif
+
+#if CONFIG_CPU_PROFILE_ENABLED == 1
+    /* Enable the cycle counter first to profile the drivers initialization */
+    (void)cpu_profile_init();
+#endif
     
     error = logger_init(&log_settings);
     if(error != NO_ERROR)
@@ -53,6 +83,36 @@ static void early_init(void)
         kernel_panic(error);
     }
     KERNEL_LOG_INFO("Serial initialized", NULL, 0, error);
+
+#if CONFIG_CRASH_LOG_ENABLED == 1
+    /* Sent while the serial output is still synchronous */
+    if(crash_log_get_panic(&panic) == NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Previous run panic", 
+                         (void*)&panic, 
+                         sizeof(panic),
+                         (ERROR_CODE_E)panic.reason);
+        KERNEL_LOG_INFO("Crash log start", NULL, 0, NO_ERROR);
+        (void)crash_log_flush(&log_settings);
+        KERNEL_LOG_INFO("Crash log end", NULL, 0, NO_ERROR);
+    }
+#endif
+}
+
+/**
+ * @brief Main task routine.
+ * 
+ * @details Main task routine, calls the user's application entry point. The
+ * main task runs unprivileged on its own stack and enters the kernel through
+ * system calls only.
+ * 
+ * @param[in] args Unused.
+ */
+static void main_task_entry(void* args)
+{
+    (void)args;
+
+    (void)user_main();
 }
 
 /*******************************************************************************
@@ -76,6 +136,40 @@ void kernel_kickstart(void)
     early_init();    
     
     /* Interrupt init */
+    error = kernel_interrupt_init();
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Interrupt initialization error", 
+                         (void*)&error, 
+                         sizeof(error),
+                         error);
+       
+        kernel_panic(error);
+    }
+
+    /* Serial interrupt driven transmission */
+    error = serial_enable_async();
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Serial asynchronous initialization error", 
+                         (void*)&error, 
+                         sizeof(error),
+                         error);
+       
+        kernel_panic(error);
+    }
+
+    /* Scheduler init */
+    error = sched_init();
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Scheduler initialization error", 
+                         (void*)&error, 
+                         sizeof(error),
+                         error);
+       
+        kernel_panic(error);
+    }
         
     /* Timers init */
     error = cpu_timer_set_frequency(CONFIG_MAIN_TIMER_TICK_FREQ);
@@ -100,8 +194,58 @@ void kernel_kickstart(void)
     }
 
     /* Memory management init */
+    error = kheap_init();
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Memory management initialization error", 
+                         (void*)&error, 
+                         sizeof(error),
+                         error);
+       
+        kernel_panic(error);
+    }
+
+    error = cpu_mpu_init();
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Memory protection initialization error", 
+                         (void*)&error, 
+                         sizeof(error),
+                         error);
+       
+        kernel_panic(error);
+    }
+
+    /* Main task creation */
+    error = sched_create_user_task(&main_task, "main", 
+                                   CONFIG_MAIN_TASK_PRIORITY,
+                                   main_task_entry, NULL,
+                                   main_stack, sizeof(main_stack));
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Main task creation error", 
+                         (void*)&error, 
+                         sizeof(error),
+                         error);
+       
+        kernel_panic(error);
+    }
+
+#if CONFIG_KERNEL_BENCH_ENABLED == 1
+    /* Kernel benchmarks, run before the main task */
+    error = kernel_bench_start();
+    if(error != NO_ERROR)
+    {
+        KERNEL_LOG_ERROR("Kernel benchmark creation error", 
+                         (void*)&error, 
+                         sizeof(error),
+                         error);
+       
+        kernel_panic(error);
+    }
+#endif
 
     KERNEL_LOG_INFO("Kernel initialized", NULL, 0, NO_ERROR);
     
-    while(1);
+    sched_start();
 }
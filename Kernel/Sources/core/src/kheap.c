@@ -0,0 +1,572 @@
+/*******************************************************************************
+ * @file kheap.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel general purpose heap allocator.
+ *
+ * @details Kernel general purpose heap allocator. Free blocks are stored in
+ * segregated lists indexed by a first level (power of two of the size) and a
+ * second level (linear subdivision of the first level). Two levels of bitmaps
+ * give the first non empty list able to hold a request with two bit scans.
+ * Adjacent free blocks are merged on release using the physical neighbours
+ * links.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "logger.h"
+#include "kheap.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Log2 of the allocation alignment. */
+#define KHEAP_ALIGN_LOG2 3
+
+/** @brief Log2 of the number of second level lists per first level. */
+#define KHEAP_SL_LOG2 4
+/** @brief Number of second level lists per first level. */
+#define KHEAP_SL_COUNT (1U << KHEAP_SL_LOG2)
+
+/** @brief First level of the blocks smaller than KHEAP_SMALL_SIZE. */
+#define KHEAP_FL_SHIFT (KHEAP_SL_LOG2 + KHEAP_ALIGN_LOG2)
+/** @brief Blocks smaller than this size are linearly indexed in level 0. */
+#define KHEAP_SMALL_SIZE (1U << KHEAP_FL_SHIFT)
+
+/** @brief Log2 of the maximal heap size, 128KB covers the whole SDRAM. */
+#define KHEAP_FL_MAX_LOG2 17
+/** @brief Number of first level lists. */
+#define KHEAP_FL_COUNT (KHEAP_FL_MAX_LOG2 - KHEAP_FL_SHIFT + 1)
+
+/** @brief Block size flag: the block is free. */
+#define KHEAP_BLOCK_FREE      0x1
+/** @brief Block size flag: the previous physical block is free. */
+#define KHEAP_BLOCK_PREV_FREE 0x2
+/** @brief Block size flags mask. */
+#define KHEAP_BLOCK_FLAGS     (KHEAP_ALIGN - 1)
+
+/** @brief Heap block header. */
+struct KHEAP_BLOCK
+{
+    /** @brief Previous physical block, valid when it is free. */
+    struct KHEAP_BLOCK* prev_phys;
+    /** @brief Size of the block's payload and flags. */
+    size_t size;
+
+    /** @brief Next free block in the list, stored in the payload. */
+    struct KHEAP_BLOCK* next_free;
+    /** @brief Previous free block in the list, stored in the payload. */
+    struct KHEAP_BLOCK* prev_free;
+};
+
+/** @brief Short hand for struct KHEAP_BLOCK */
+typedef struct KHEAP_BLOCK KHEAP_BLOCK_T;
+
+/** @brief Size of the block header preceding an allocated payload. */
+#define KHEAP_HEADER_SIZE (sizeof(KHEAP_BLOCK_T*) + sizeof(size_t))
+/** @brief Minimal payload size, holding the free list links. */
+#define KHEAP_MIN_SIZE (sizeof(KHEAP_BLOCK_T) - KHEAP_HEADER_SIZE)
+
+/** @brief Kernel heap start, defined by the linker script. */
+extern uint8_t _start_heap;
+
+/** @brief Kernel heap end, defined by the linker script. */
+extern uint8_t _end_heap;
+
+/** @brief First level bitmap, bit i is set if the level i is not empty. */
+static uint32_t fl_bitmap = 0;
+
+/** @brief Second level bitmaps. */
+static uint32_t sl_bitmap[KHEAP_FL_COUNT];
+
+/** @brief Free lists heads. */
+static KHEAP_BLOCK_T* free_lists[KHEAP_FL_COUNT][KHEAP_SL_COUNT];
+
+/** @brief Start address of the managed region. */
+static uintptr_t heap_start = 0;
+
+/** @brief End address of the managed region. */
+static uintptr_t heap_end = 0;
+
+/** @brief Heap statistics. */
+static KHEAP_STATS_T heap_stats;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Returns the index of the most significant bit set.
+ *
+ * @param[in] value The value to scan, must not be 0.
+ *
+ * @return The index of the most significant bit set is returned.
+ */
+static uint32_t kheap_fls(const uint32_t value)
+{
+    return 31 - (uint32_t)__builtin_clz(value);
+}
+
+/**
+ * @brief Returns the index of the least significant bit set.
+ *
+ * @param[in] value The value to scan, must not be 0.
+ *
+ * @return The index of the least significant bit set is returned.
+ */
+static uint32_t kheap_ffs(const uint32_t value)
+{
+    return (uint32_t)__builtin_ctz(value);
+}
+
+/**
+ * @brief Returns the payload size of a block.
+ *
+ * @param[in] block The block to get the size of.
+ *
+ * @return The payload size of the block is returned.
+ */
+static size_t kheap_block_size(const KHEAP_BLOCK_T* block)
+{
+    return block->size & ~(size_t)KHEAP_BLOCK_FLAGS;
+}
+
+/**
+ * @brief Returns the next physical block.
+ *
+ * @param[in] block The block to get the neighbour of.
+ *
+ * @return The next physical block is returned.
+ */
+static KHEAP_BLOCK_T* kheap_block_next(const KHEAP_BLOCK_T* block)
+{
+    return (KHEAP_BLOCK_T*)((uintptr_t)block + KHEAP_HEADER_SIZE + 
+                            kheap_block_size(block));
+}
+
+/**
+ * @brief Computes the lists indexes of a block size.
+ *
+ * @param[in] size The block size.
+ * @param[out] fl The first level index.
+ * @param[out] sl The second level index.
+ */
+static void kheap_mapping(const size_t size, uint32_t* fl, uint32_t* sl)
+{
+    uint32_t first;
+
+    if(size < KHEAP_SMALL_SIZE)
+    {
+        *fl = 0;
+        *sl = size >> KHEAP_ALIGN_LOG2;
+    }
+    else
+    {
+        first = kheap_fls(size);
+        *sl   = (size >> (first - KHEAP_SL_LOG2)) ^ KHEAP_SL_COUNT;
+        *fl   = first - (KHEAP_FL_SHIFT - 1);
+    }
+}
+
+/**
+ * @brief Inserts a block in its free list.
+ *
+ * @param[in] block The free block to insert.
+ */
+static void kheap_insert(KHEAP_BLOCK_T* block)
+{
+    uint32_t fl;
+    uint32_t sl;
+
+    kheap_mapping(kheap_block_size(block), &fl, &sl);
+
+    block->prev_free = NULL;
+    block->next_free = free_lists[fl][sl];
+    if(block->next_free != NULL)
+    {
+        block->next_free->prev_free = block;
+    }
+    free_lists[fl][sl] = block;
+
+    fl_bitmap     |= (1U << fl);
+    sl_bitmap[fl] |= (1U << sl);
+}
+
+/**
+ * @brief Removes a block from its free list.
+ *
+ * @param[in] block The free block to remove.
+ */
+static void kheap_remove(KHEAP_BLOCK_T* block)
+{
+    uint32_t fl;
+    uint32_t sl;
+
+    kheap_mapping(kheap_block_size(block), &fl, &sl);
+
+    if(block->prev_free != NULL)
+    {
+        block->prev_free->next_free = block->next_free;
+    }
+    else
+    {
+        free_lists[fl][sl] = block->next_free;
+    }
+    if(block->next_free != NULL)
+    {
+        block->next_free->prev_free = block->prev_free;
+    }
+
+    if(free_lists[fl][sl] == NULL)
+    {
+        sl_bitmap[fl] &= ~(1U << sl);
+        if(sl_bitmap[fl] == 0)
+        {
+            fl_bitmap &= ~(1U << fl);
+        }
+    }
+}
+
+/**
+ * @brief Finds a free block in the lists of larger blocks.
+ *
+ * @details Finds the first non empty free list starting at the given indexes.
+ *
+ * @param[in] fl The first level index to start from.
+ * @param[in] sl The second level index to start from.
+ *
+ * @return A free block is returned. NULL is returned if all the lists are 
+ * empty.
+ */
+static KHEAP_BLOCK_T* kheap_find_from(uint32_t fl, uint32_t sl)
+{
+    uint32_t map;
+
+    if(fl >= KHEAP_FL_COUNT)
+    {
+        return NULL;
+    }
+
+    map = sl_bitmap[fl] & (~0U << sl);
+    if(map == 0)
+    {
+        if(fl + 1 >= KHEAP_FL_COUNT)
+        {
+            return NULL;
+        }
+        map = fl_bitmap & (~0U << (fl + 1));
+        if(map == 0)
+        {
+            return NULL;
+        }
+        fl  = kheap_ffs(map);
+        map = sl_bitmap[fl];
+    }
+    sl = kheap_ffs(map);
+
+    return free_lists[fl][sl];
+}
+
+/**
+ * @brief Finds a free block large enough for a request.
+ *
+ * @details Finds the first non empty free list whose blocks are all large 
+ * enough to hold size bytes. If there is none, the first block of the list 
+ * the request belongs to is checked.
+ *
+ * @param[in] size The requested payload size, aligned.
+ *
+ * @return A free block is returned. NULL is returned if no block is large
+ * enough.
+ */
+static KHEAP_BLOCK_T* kheap_find(const size_t size)
+{
+    KHEAP_BLOCK_T* block;
+    size_t         search;
+    uint32_t       fl;
+    uint32_t       sl;
+
+    /* Round up to the next list so that any block in it fits */
+    search = size;
+    if(search >= KHEAP_SMALL_SIZE)
+    {
+        search += (1U << (kheap_fls(search) - KHEAP_SL_LOG2)) - 1;
+    }
+    kheap_mapping(search, &fl, &sl);
+
+    block = kheap_find_from(fl, sl);
+    if(block == NULL)
+    {
+        /* Fallback on the list of the requested size */
+        kheap_mapping(size, &fl, &sl);
+        if(fl < KHEAP_FL_COUNT)
+        {
+            block = free_lists[fl][sl];
+            if(block != NULL && kheap_block_size(block) < size)
+            {
+                block = NULL;
+            }
+        }
+    }
+
+    return block;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E kheap_init(void)
+{
+    KHEAP_BLOCK_T* block;
+    KHEAP_BLOCK_T* sentinel;
+    uintptr_t      start;
+    uintptr_t      end;
+    uint32_t       i;
+    uint32_t       j;
+
+    if(heap_end != 0)
+    {
+        return ERROR_ALREADY_INIT;
+    }
+
+    start = ((uintptr_t)&_start_heap + KHEAP_ALIGN - 1) & 
+            ~(uintptr_t)(KHEAP_ALIGN - 1);
+    end   = (uintptr_t)&_end_heap & ~(uintptr_t)(KHEAP_ALIGN - 1);
+
+    /* Blocks cannot be bigger than the last first level */
+    if(end - start >= (1U << KHEAP_FL_MAX_LOG2))
+    {
+        end = start + (1U << KHEAP_FL_MAX_LOG2) - KHEAP_ALIGN;
+    }
+    if(end <= start || 
+       end - start < 2 * KHEAP_HEADER_SIZE + KHEAP_MIN_SIZE)
+    {
+        KERNEL_LOG_ERROR("Kernel heap region too small", 
+                         NULL, 
+                         0,
+                         ERROR_NO_MEMORY);
+        return ERROR_NO_MEMORY;
+    }
+
+    fl_bitmap = 0;
+    for(i = 0; i < KHEAP_FL_COUNT; ++i)
+    {
+        sl_bitmap[i] = 0;
+        for(j = 0; j < KHEAP_SL_COUNT; ++j)
+        {
+            free_lists[i][j] = NULL;
+        }
+    }
+
+    /* One free block spanning the region, followed by a used sentinel */
+    block            = (KHEAP_BLOCK_T*)start;
+    block->prev_phys = NULL;
+    block->size      = (end - start - 2 * KHEAP_HEADER_SIZE) | 
+                       KHEAP_BLOCK_FREE;
+
+    sentinel            = kheap_block_next(block);
+    sentinel->prev_phys = block;
+    sentinel->size      = KHEAP_BLOCK_PREV_FREE;
+
+    kheap_insert(block);
+
+    heap_start = start;
+    heap_end   = end;
+
+    heap_stats.total_size         = kheap_block_size(block);
+    heap_stats.free_size          = heap_stats.total_size;
+    heap_stats.min_free_size      = heap_stats.total_size;
+    heap_stats.largest_free_block = heap_stats.total_size;
+    heap_stats.fragmentation      = 0;
+    heap_stats.alloc_count        = 0;
+    heap_stats.free_count         = 0;
+    heap_stats.fail_count         = 0;
+
+    KERNEL_LOG_INFO("Kernel heap initialized", NULL, 0, NO_ERROR);
+
+    return NO_ERROR;
+}
+
+void* kmalloc(const size_t size)
+{
+    KHEAP_BLOCK_T* block;
+    KHEAP_BLOCK_T* remain;
+    size_t         adjusted;
+    size_t         block_size;
+    uint32_t       int_state;
+
+    if(size == 0 || size >= (1U << KHEAP_FL_MAX_LOG2) || heap_end == 0)
+    {
+        return NULL;
+    }
+
+    adjusted = (size + KHEAP_ALIGN - 1) & ~(size_t)(KHEAP_ALIGN - 1);
+    if(adjusted < KHEAP_MIN_SIZE)
+    {
+        adjusted = KHEAP_MIN_SIZE;
+    }
+
+    int_state = cpu_enter_critical();
+
+    block = kheap_find(adjusted);
+    if(block == NULL)
+    {
+        ++heap_stats.fail_count;
+        cpu_exit_critical(int_state);
+        return NULL;
+    }
+    kheap_remove(block);
+
+    /* Split the block if the remainder can hold a free block */
+    block_size = kheap_block_size(block);
+    if(block_size >= adjusted + KHEAP_HEADER_SIZE + KHEAP_MIN_SIZE)
+    {
+        remain            = (KHEAP_BLOCK_T*)((uintptr_t)block + 
+                                             KHEAP_HEADER_SIZE + adjusted);
+        remain->prev_phys = block;
+        remain->size      = (block_size - adjusted - KHEAP_HEADER_SIZE) |
+                            KHEAP_BLOCK_FREE;
+        kheap_block_next(remain)->prev_phys = remain;
+
+        block->size = adjusted | (block->size & KHEAP_BLOCK_FLAGS);
+        kheap_insert(remain);
+
+        heap_stats.free_size -= adjusted + KHEAP_HEADER_SIZE;
+    }
+    else
+    {
+        kheap_block_next(block)->size &= ~(size_t)KHEAP_BLOCK_PREV_FREE;
+
+        heap_stats.free_size -= block_size;
+    }
+    block->size &= ~(size_t)KHEAP_BLOCK_FREE;
+
+    ++heap_stats.alloc_count;
+    if(heap_stats.free_size < heap_stats.min_free_size)
+    {
+        heap_stats.min_free_size = heap_stats.free_size;
+    }
+
+    cpu_exit_critical(int_state);
+
+    return (void*)((uintptr_t)block + KHEAP_HEADER_SIZE);
+}
+
+ERROR_CODE_E kfree(void* ptr)
+{
+    KHEAP_BLOCK_T* block;
+    KHEAP_BLOCK_T* prev;
+    KHEAP_BLOCK_T* next;
+    uint32_t       int_state;
+
+    if(ptr == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    block = (KHEAP_BLOCK_T*)((uintptr_t)ptr - KHEAP_HEADER_SIZE);
+    if((uintptr_t)block < heap_start || (uintptr_t)ptr >= heap_end ||
+       ((uintptr_t)ptr & (KHEAP_ALIGN - 1)) != 0 ||
+       (block->size & KHEAP_BLOCK_FREE) != 0)
+    {
+        KERNEL_LOG_ERROR("Invalid kernel heap release", 
+                         (void*)&ptr, 
+                         sizeof(ptr),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    int_state = cpu_enter_critical();
+
+    heap_stats.free_size += kheap_block_size(block);
+    ++heap_stats.free_count;
+
+    block->size |= KHEAP_BLOCK_FREE;
+
+    /* Merge with the previous physical block */
+    if((block->size & KHEAP_BLOCK_PREV_FREE) != 0)
+    {
+        prev = block->prev_phys;
+        kheap_remove(prev);
+        prev->size += KHEAP_HEADER_SIZE + kheap_block_size(block);
+        block = prev;
+
+        heap_stats.free_size += KHEAP_HEADER_SIZE;
+    }
+
+    /* Merge with the next physical block */
+    next = kheap_block_next(block);
+    if((next->size & KHEAP_BLOCK_FREE) != 0)
+    {
+        kheap_remove(next);
+        block->size += KHEAP_HEADER_SIZE + kheap_block_size(next);
+        next = kheap_block_next(block);
+
+        heap_stats.free_size += KHEAP_HEADER_SIZE;
+    }
+
+    next->prev_phys = block;
+    next->size     |= KHEAP_BLOCK_PREV_FREE;
+
+    kheap_insert(block);
+
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kheap_get_stats(KHEAP_STATS_T* stats)
+{
+    KHEAP_BLOCK_T* block;
+    size_t         largest;
+    uint32_t       fl;
+    uint32_t       sl;
+    uint32_t       int_state;
+
+    if(stats == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+
+    /* The largest free block is in the highest non empty list */
+    largest = 0;
+    if(fl_bitmap != 0)
+    {
+        fl = kheap_fls(fl_bitmap);
+        sl = kheap_fls(sl_bitmap[fl]);
+        for(block = free_lists[fl][sl]; block != NULL; block = block->next_free)
+        {
+            if(kheap_block_size(block) > largest)
+            {
+                largest = kheap_block_size(block);
+            }
+        }
+    }
+
+    heap_stats.largest_free_block = largest;
+    heap_stats.fragmentation      = 0;
+    if(heap_stats.free_size != 0)
+    {
+        heap_stats.fragmentation = 
+            100 - (uint32_t)((largest * 100) / heap_stats.free_size);
+    }
+
+    *stats = heap_stats;
+
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * @file mem_pool.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel fixed-size block memory pools.
+ *
+ * @details Kernel fixed-size block memory pools. Each pool keeps its free 
+ * blocks in a singly linked list stored in the blocks themselves. The pools 
+ * memory is allocated from the kernel heap.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "logger.h"
+#include "kheap.h"
+#include "mem_pool.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Aligns a value on MEM_POOL_BLOCK_ALIGN.
+ *
+ * @param[in] value The value to align.
+ *
+ * @return The value rounded up to the next MEM_POOL_BLOCK_ALIGN multiple.
+ */
+static uintptr_t mem_pool_align(const uintptr_t value)
+{
+    return (value + MEM_POOL_BLOCK_ALIGN - 1) & 
+           ~(uintptr_t)(MEM_POOL_BLOCK_ALIGN - 1);
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E mem_pool_create(MEM_POOL_T* pool,
+                             const char* name,
+                             const size_t block_size,
+                             const uint32_t block_count)
+{
+    MEM_POOL_BLOCK_T* block;
+    size_t            size;
+    uint32_t          i;
+
+    if(pool == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(block_size == 0 || block_count == 0)
+    {
+        KERNEL_LOG_ERROR("Memory pool invalid parameter", 
+                         (void*)&block_size, 
+                         sizeof(block_size),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    size = mem_pool_align(block_size);
+
+    /* Allocate the pool from the kernel heap */
+    if(block_count > (size_t)-1 / size)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+    pool->start = (uintptr_t)kmalloc(size * block_count);
+    if(pool->start == 0)
+    {
+        KERNEL_LOG_ERROR("Not enough memory to create the pool", 
+                         (void*)&block_count, 
+                         sizeof(block_count),
+                         ERROR_NO_MEMORY);
+        return ERROR_NO_MEMORY;
+    }
+
+    pool->name        = name;
+    pool->end         = pool->start + size * block_count;
+    pool->block_size  = size;
+    pool->block_count = block_count;
+    pool->used_count  = 0;
+    pool->high_water  = 0;
+    pool->fail_count  = 0;
+
+    /* Link all the blocks in the free list */
+    pool->free_list = (MEM_POOL_BLOCK_T*)pool->start;
+    block           = pool->free_list;
+    for(i = 1; i < block_count; ++i)
+    {
+        block->next = (MEM_POOL_BLOCK_T*)((uintptr_t)block + size);
+        block       = block->next;
+    }
+    block->next = NULL;
+
+    return NO_ERROR;
+}
+
+void* mem_pool_alloc(MEM_POOL_T* pool)
+{
+    MEM_POOL_BLOCK_T* block;
+    uint32_t          int_state;
+
+    if(pool == NULL)
+    {
+        return NULL;
+    }
+
+    int_state = cpu_enter_critical();
+
+    block = pool->free_list;
+    if(block != NULL)
+    {
+        pool->free_list = block->next;
+        ++pool->used_count;
+        if(pool->used_count > pool->high_water)
+        {
+            pool->high_water = pool->used_count;
+        }
+    }
+    else
+    {
+        ++pool->fail_count;
+    }
+
+    cpu_exit_critical(int_state);
+
+    return block;
+}
+
+ERROR_CODE_E mem_pool_free(MEM_POOL_T* pool, void* block)
+{
+    MEM_POOL_BLOCK_T* free_block;
+    uint32_t          int_state;
+
+    if(pool == NULL || block == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if((uintptr_t)block < pool->start || (uintptr_t)block >= pool->end ||
+       ((uintptr_t)block - pool->start) % pool->block_size != 0)
+    {
+        KERNEL_LOG_ERROR("Block does not belong to the pool", 
+                         (void*)&block, 
+                         sizeof(block),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    free_block = (MEM_POOL_BLOCK_T*)block;
+
+    int_state = cpu_enter_critical();
+    free_block->next = pool->free_list;
+    pool->free_list  = free_block;
+    --pool->used_count;
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E mem_pool_get_stats(const MEM_POOL_T* pool, 
+                                MEM_POOL_STATS_T* stats)
+{
+    uint32_t int_state;
+
+    if(pool == NULL || stats == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+    stats->block_size  = pool->block_size;
+    stats->block_count = pool->block_count;
+    stats->used_count  = pool->used_count;
+    stats->high_water  = pool->high_water;
+    stats->fail_count  = pool->fail_count;
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E mem_pool_destroy(MEM_POOL_T* pool)
+{
+    ERROR_CODE_E error;
+
+    if(pool == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(pool->used_count != 0)
+    {
+        KERNEL_LOG_ERROR("Destroying a pool with allocated blocks", 
+                         (void*)&pool->used_count, 
+                         sizeof(pool->used_count),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    error = kfree((void*)pool->start);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    pool->free_list   = NULL;
+    pool->start       = 0;
+    pool->end         = 0;
+    pool->block_count = 0;
+
+    return NO_ERROR;
+}
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * @file msg_queue.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel zero-copy message queues.
+ *
+ * @details Kernel zero-copy message queues. The queue stores message pointers
+ * in a circular array. Blocked senders keep their message in their task 
+ * control block until a receiver makes room for it, blocked receivers get 
+ * their message the same way. Every operation is done in constant time 
+ * inside a kernel critical section.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "logger.h"
+#include "kheap.h"
+#include "scheduler.h"
+#include "msg_queue.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Stores a message at the end of the queue.
+ *
+ * @details Stores a message at the end of the queue. The queue must not be
+ * full. This must be called inside a kernel critical section.
+ *
+ * @param[in, out] queue The queue to update.
+ * @param[in] msg The message to store.
+ */
+static void msg_queue_push(MSG_QUEUE_T* queue, void* msg)
+{
+    uint32_t index;
+
+    index = queue->head + queue->count;
+    if(index >= queue->capacity)
+    {
+        index -= queue->capacity;
+    }
+
+    queue->messages[index] = msg;
+    ++queue->count;
+
+    if(queue->count > queue->high_water)
+    {
+        queue->high_water = queue->count;
+    }
+}
+
+/**
+ * @brief Removes the oldest message of the queue.
+ *
+ * @details Removes the oldest message of the queue. The queue must not be 
+ * empty. This must be called inside a kernel critical section.
+ *
+ * @param[in, out] queue The queue to update.
+ *
+ * @return The oldest message is returned.
+ */
+static void* msg_queue_pop(MSG_QUEUE_T* queue)
+{
+    void* msg;
+
+    msg = queue->messages[queue->head];
+    if(++queue->head == queue->capacity)
+    {
+        queue->head = 0;
+    }
+    --queue->count;
+
+    return msg;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E msg_queue_create(MSG_QUEUE_T* queue,
+                              const char* name,
+                              const uint32_t capacity)
+{
+    if(queue == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    queue->messages = NULL;
+    if(capacity != 0)
+    {
+        queue->messages = kmalloc(capacity * sizeof(void*));
+        if(queue->messages == NULL)
+        {
+            KERNEL_LOG_ERROR("Message queue allocation failed", 
+                             (void*)&capacity, 
+                             sizeof(capacity),
+                             ERROR_NO_MEMORY);
+            return ERROR_NO_MEMORY;
+        }
+    }
+
+    queue->name       = name;
+    queue->capacity   = capacity;
+    queue->head       = 0;
+    queue->count      = 0;
+    queue->high_water = 0;
+
+    (void)sched_wait_queue_init(&queue->receivers);
+    (void)sched_wait_queue_init(&queue->senders);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E msg_queue_destroy(MSG_QUEUE_T* queue)
+{
+    ERROR_CODE_E error;
+
+    if(queue == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(queue->receivers.head != NULL || queue->senders.head != NULL)
+    {
+        KERNEL_LOG_ERROR("Destroying a message queue with waiting tasks", 
+                         NULL, 
+                         0,
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    if(queue->messages != NULL)
+    {
+        error = kfree(queue->messages);
+        if(error != NO_ERROR)
+        {
+            return error;
+        }
+    }
+
+    queue->messages = NULL;
+    queue->capacity = 0;
+    queue->count    = 0;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E msg_queue_send(MSG_QUEUE_T* queue,
+                            void* msg,
+                            const uint32_t timeout)
+{
+    KERNEL_TASK_T* task;
+    uint32_t       int_state;
+
+    if(queue == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+
+    /* Hand the message to a waiting receiver */
+    task = sched_wake_one(&queue->receivers, NO_ERROR);
+    if(task != NULL)
+    {
+        task->wait_data = (uintptr_t)msg;
+        cpu_exit_critical(int_state);
+        return NO_ERROR;
+    }
+
+    if(queue->count < queue->capacity)
+    {
+        msg_queue_push(queue, msg);
+        cpu_exit_critical(int_state);
+        return NO_ERROR;
+    }
+
+    /* The queue is full, wait for a receiver to take the message */
+    return sched_wait_data(&queue->senders, 
+                           timeout, 
+                           (uintptr_t)msg, 
+                           int_state);
+}
+
+ERROR_CODE_E msg_queue_receive(MSG_QUEUE_T* queue,
+                               void** msg,
+                               const uint32_t timeout)
+{
+    KERNEL_TASK_T* task;
+    uint32_t       int_state;
+    ERROR_CODE_E   error;
+
+    if(queue == NULL || msg == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+
+    if(queue->count != 0)
+    {
+        *msg = msg_queue_pop(queue);
+
+        /* Move the message of a waiting sender in the freed slot */
+        task = sched_wake_one(&queue->senders, NO_ERROR);
+        if(task != NULL)
+        {
+            msg_queue_push(queue, (void*)task->wait_data);
+        }
+
+        cpu_exit_critical(int_state);
+        return NO_ERROR;
+    }
+
+    /* Without storage, take the message from a waiting sender */
+    task = sched_wake_one(&queue->senders, NO_ERROR);
+    if(task != NULL)
+    {
+        *msg = (void*)task->wait_data;
+        cpu_exit_critical(int_state);
+        return NO_ERROR;
+    }
+
+    /* The queue is empty, wait for a sender to give a message */
+    task  = sched_get_current_task();
+    error = sched_wait(&queue->receivers, timeout, int_state);
+    if(error == NO_ERROR)
+    {
+        *msg = (void*)task->wait_data;
+    }
+
+    return error;
+}
+
+uint32_t msg_queue_get_count(const MSG_QUEUE_T* queue)
+{
+    if(queue == NULL)
+    {
+        return 0;
+    }
+
+    return queue->count;
+}
@@ -0,0 +1,336 @@
+/*******************************************************************************
+ * @file mutex.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel priority inheritance mutexes.
+ *
+ * @details Kernel priority inheritance mutexes. The fast paths only use the 
+ * CPU atomic compare and swap on the owner word. The slow paths run inside a
+ * kernel critical section: the first waiter sets the contended flag, which 
+ * makes the owner's fast unlock fail, and links the mutex to the owner's 
+ * contended mutexes list used to compute its inherited priority. On unlock, 
+ * the ownership is handed to the highest priority waiter.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "cpu_atomic.h"
+#include "logger.h"
+#include "scheduler.h"
+#include "mutex.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Returns the owner task of a mutex.
+ *
+ * @param[in] owner The mutex owner word.
+ *
+ * @return The owner task is returned, NULL if the mutex is free.
+ */
+static KERNEL_TASK_T* kernel_mutex_owner(const uint32_t owner)
+{
+    return (KERNEL_TASK_T*)(uintptr_t)(owner & ~KERNEL_MUTEX_CONTENDED);
+}
+
+/**
+ * @brief Removes a mutex from its owner's contended mutexes list.
+ *
+ * @details Removes a mutex from its owner's contended mutexes list. This must
+ * be called inside a kernel critical section.
+ *
+ * @param[in, out] task The owner task.
+ * @param[in] mutex The mutex to remove.
+ */
+static void kernel_mutex_unlink(KERNEL_TASK_T* task, KERNEL_MUTEX_T* mutex)
+{
+    KERNEL_MUTEX_T** cursor;
+
+    cursor = &task->held_mutexes;
+    while(*cursor != NULL && *cursor != mutex)
+    {
+        cursor = &(*cursor)->next_held;
+    }
+    if(*cursor != NULL)
+    {
+        *cursor = mutex->next_held;
+    }
+    mutex->next_held = NULL;
+}
+
+/**
+ * @brief Updates the inherited priority of a task.
+ *
+ * @details Updates the inherited priority of a task: the highest priority 
+ * between its base priority and the priority of the first waiter of each
+ * contended mutex it holds. This must be called inside a kernel critical 
+ * section.
+ *
+ * @param[in, out] task The task to update.
+ */
+static void kernel_mutex_update_priority(KERNEL_TASK_T* task)
+{
+    KERNEL_MUTEX_T* mutex;
+    uint8_t         priority;
+
+    priority = task->base_priority;
+    for(mutex = task->held_mutexes; mutex != NULL; mutex = mutex->next_held)
+    {
+        if(mutex->waiters.head != NULL &&
+           mutex->waiters.head->priority < priority)
+        {
+            priority = mutex->waiters.head->priority;
+        }
+    }
+
+    sched_set_priority(task, priority);
+}
+
+/**
+ * @brief Propagates a waiter priority to the chain of owners.
+ *
+ * @details Propagates a waiter priority to the owner of the mutex and, if the
+ * owner itself waits for a mutex, to the next owners. This must be called 
+ * inside a kernel critical section.
+ *
+ * @param[in] mutex The mutex the waiter waits for.
+ * @param[in] priority The waiter priority.
+ */
+static void kernel_mutex_inherit(KERNEL_MUTEX_T* mutex, const uint8_t priority)
+{
+    KERNEL_TASK_T* owner;
+
+    while(mutex != NULL)
+    {
+        owner = kernel_mutex_owner(mutex->owner);
+        if(owner == NULL || owner->priority <= priority)
+        {
+            break;
+        }
+
+        sched_set_priority(owner, priority);
+        mutex = owner->blocking_mutex;
+    }
+}
+
+/**
+ * @brief Mutex lock slow path.
+ *
+ * @details Mutex lock slow path, the mutex is owned by another task. The 
+ * caller waits for the ownership to be handed to it.
+ *
+ * @param[in, out] mutex The mutex to lock.
+ * @param[in] timeout The maximal number of ticks to wait.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned.
+ */
+static ERROR_CODE_E kernel_mutex_lock_slow(KERNEL_MUTEX_T* mutex,
+                                           const uint32_t timeout)
+{
+    KERNEL_TASK_T* task;
+    KERNEL_TASK_T* owner;
+    uint32_t       int_state;
+    ERROR_CODE_E   error;
+
+    task = sched_get_current_task();
+
+    int_state = cpu_enter_critical();
+
+    /* The mutex may have been released in between */
+    owner = kernel_mutex_owner(mutex->owner);
+    if(owner == NULL)
+    {
+        mutex->owner = (uint32_t)(uintptr_t)task;
+        cpu_exit_critical(int_state);
+        return NO_ERROR;
+    }
+    if(owner == task)
+    {
+        cpu_exit_critical(int_state);
+        KERNEL_LOG_ERROR("Mutex already owned by the task", 
+                         (void*)&mutex, 
+                         sizeof(mutex),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+    if(timeout == 0)
+    {
+        cpu_exit_critical(int_state);
+        return ERROR_TIMEOUT;
+    }
+
+    /* First waiter, make the owner's fast unlock fail */
+    if((mutex->owner & KERNEL_MUTEX_CONTENDED) == 0)
+    {
+        mutex->owner       |= KERNEL_MUTEX_CONTENDED;
+        mutex->next_held    = owner->held_mutexes;
+        owner->held_mutexes = mutex;
+    }
+
+    task->blocking_mutex = mutex;
+    kernel_mutex_inherit(mutex, task->priority);
+
+    error = sched_wait(&mutex->waiters, timeout, int_state);
+    if(error == NO_ERROR)
+    {
+        return NO_ERROR;
+    }
+
+    /* Timeout, drop the priority given to the owner */
+    int_state = cpu_enter_critical();
+
+    task->blocking_mutex = NULL;
+    owner = kernel_mutex_owner(mutex->owner);
+    if(owner != NULL)
+    {
+        if(mutex->waiters.head == NULL)
+        {
+            mutex->owner = (uint32_t)(uintptr_t)owner;
+            kernel_mutex_unlink(owner, mutex);
+        }
+        kernel_mutex_update_priority(owner);
+    }
+
+    cpu_exit_critical(int_state);
+
+    return error;
+}
+
+/**
+ * @brief Mutex unlock slow path.
+ *
+ * @details Mutex unlock slow path, tasks wait for the mutex. The ownership is
+ * handed to the highest priority waiter.
+ *
+ * @param[in, out] mutex The mutex to unlock.
+ * @param[in, out] task The owner task.
+ */
+static void kernel_mutex_unlock_slow(KERNEL_MUTEX_T* mutex, 
+                                     KERNEL_TASK_T* task)
+{
+    KERNEL_TASK_T* waiter;
+    uint32_t       int_state;
+
+    int_state = cpu_enter_critical();
+
+    /* Drop the inherited priority first so that the waiter preempts us */
+    kernel_mutex_unlink(task, mutex);
+    kernel_mutex_update_priority(task);
+
+    waiter = sched_wake_one(&mutex->waiters, NO_ERROR);
+    if(waiter == NULL)
+    {
+        mutex->owner = 0;
+        cpu_exit_critical(int_state);
+        return;
+    }
+
+    waiter->blocking_mutex = NULL;
+    mutex->owner           = (uint32_t)(uintptr_t)waiter;
+
+    /* The new owner inherits from the remaining waiters */
+    if(mutex->waiters.head != NULL)
+    {
+        mutex->owner        |= KERNEL_MUTEX_CONTENDED;
+        mutex->next_held     = waiter->held_mutexes;
+        waiter->held_mutexes = mutex;
+        kernel_mutex_update_priority(waiter);
+    }
+
+    cpu_exit_critical(int_state);
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E kernel_mutex_init(KERNEL_MUTEX_T* mutex, const char* name)
+{
+    if(mutex == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    mutex->name      = name;
+    mutex->owner     = 0;
+    mutex->next_held = NULL;
+
+    return sched_wait_queue_init(&mutex->waiters);
+}
+
+ERROR_CODE_E kernel_mutex_lock(KERNEL_MUTEX_T* mutex, const uint32_t timeout)
+{
+    KERNEL_TASK_T* task;
+
+    if(mutex == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    task = sched_get_current_task();
+    if(task == NULL || cpu_is_interrupt() != 0)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    /* Fast path, the mutex is free */
+    if(cpu_atomic_cas(&mutex->owner, 0, (uint32_t)(uintptr_t)task) == 0)
+    {
+        return NO_ERROR;
+    }
+
+    return kernel_mutex_lock_slow(mutex, timeout);
+}
+
+ERROR_CODE_E kernel_mutex_unlock(KERNEL_MUTEX_T* mutex)
+{
+    KERNEL_TASK_T* task;
+    uint32_t       owner;
+
+    if(mutex == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    task = sched_get_current_task();
+    if(task == NULL)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    /* Fast path, no task waits for the mutex */
+    owner = cpu_atomic_cas(&mutex->owner, (uint32_t)(uintptr_t)task, 0);
+    if(owner == (uint32_t)(uintptr_t)task)
+    {
+        return NO_ERROR;
+    }
+
+    if(kernel_mutex_owner(owner) != task)
+    {
+        KERNEL_LOG_ERROR("Mutex not owned by the task", 
+                         (void*)&mutex, 
+                         sizeof(mutex),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    kernel_mutex_unlock_slow(mutex, task);
+
+    return NO_ERROR;
+}
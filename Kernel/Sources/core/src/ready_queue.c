@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * @file ready_queue.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel O(1) ready queue.
+ *
+ * @details Kernel O(1) ready queue. This module implements the priority bitmap
+ * and the per priority FIFOs used by the scheduler to elect the next task in
+ * constant time.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "config.h"
+#include "error_types.h"
+#include "scheduler.h"
+#include "ready_queue.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Bitmap bit of a priority level. */
+#define READY_QUEUE_PRIO_BIT(prio) (0x80000000U >> (prio))
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E ready_queue_init(READY_QUEUE_T* queue)
+{
+    uint32_t i;
+
+    if(queue == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    queue->bitmap = 0;
+    for(i = 0; i < CONFIG_SCHED_PRIORITY_COUNT; ++i)
+    {
+        queue->head[i] = NULL;
+        queue->tail[i] = NULL;
+    }
+
+    return NO_ERROR;
+}
+
+void ready_queue_push(READY_QUEUE_T* queue, KERNEL_TASK_T* task)
+{
+    uint8_t prio;
+
+    prio = task->priority;
+
+    task->state = TASK_STATE_READY;
+    task->next  = NULL;
+    task->prev  = queue->tail[prio];
+
+    if(queue->tail[prio] != NULL)
+    {
+        queue->tail[prio]->next = task;
+    }
+    else
+    {
+        queue->head[prio] = task;
+        queue->bitmap |= READY_QUEUE_PRIO_BIT(prio);
+    }
+    queue->tail[prio] = task;
+}
+
+KERNEL_TASK_T* ready_queue_pop(READY_QUEUE_T* queue)
+{
+    KERNEL_TASK_T* task;
+    uint32_t       prio;
+
+    if(queue->bitmap == 0)
+    {
+        return NULL;
+    }
+
+    /* Compiles to a single CLZ instruction */
+    prio = (uint32_t)__builtin_clz(queue->bitmap);
+    task = queue->head[prio];
+
+    queue->head[prio] = task->next;
+    if(task->next != NULL)
+    {
+        task->next->prev = NULL;
+    }
+    else
+    {
+        queue->tail[prio] = NULL;
+        queue->bitmap &= ~READY_QUEUE_PRIO_BIT(prio);
+    }
+
+    task->next = NULL;
+    task->prev = NULL;
+
+    return task;
+}
+
+void ready_queue_remove(READY_QUEUE_T* queue, KERNEL_TASK_T* task)
+{
+    uint8_t prio;
+
+    prio = task->priority;
+
+    if(task->prev != NULL)
+    {
+        task->prev->next = task->next;
+    }
+    else
+    {
+        queue->head[prio] = task->next;
+    }
+
+    if(task->next != NULL)
+    {
+        task->next->prev = task->prev;
+    }
+    else
+    {
+        queue->tail[prio] = task->prev;
+    }
+
+    if(queue->head[prio] == NULL)
+    {
+        queue->bitmap &= ~READY_QUEUE_PRIO_BIT(prio);
+    }
+
+    task->next = NULL;
+    task->prev = NULL;
+}
+
+uint32_t ready_queue_top_priority(const READY_QUEUE_T* queue)
+{
+    if(queue->bitmap == 0)
+    {
+        return CONFIG_SCHED_PRIORITY_COUNT;
+    }
+
+    return (uint32_t)__builtin_clz(queue->bitmap);
+}
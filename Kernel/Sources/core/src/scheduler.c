@@ -0,0 +1,911 @@
+/*******************************************************************************
+ * @file scheduler.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel preemptive fixed-priority scheduler.
+ *
+ * @details Kernel preemptive fixed-priority scheduler. This module implements
+ * the task creation and election. The scheduler is driven by the system tick
+ * interrupt. The context switches are deferred to the CPU pending service
+ * exception, raised each time a new task is elected.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_CORE
+
+#include "stdint.h"
+#include "stddef.h"
+#include "config.h"
+#include "error_types.h"
+#include "interrupts.h"
+#include "cpu_api.h"
+#include "cpu_timer.h"
+#include "cpu_mpu.h"
+#include "logger.h"
+#include "panic.h"
+#include "scheduler.h"
+#include "ready_queue.h"
+#include "syscall.h"
+#include "sw_timer.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/**
+ * @brief Task whose context is currently loaded on the CPU.
+ *
+ * @details Task whose context is currently loaded on the CPU. This variable is
+ * updated by the CPU context switch routine and must not be static.
+ */
+KERNEL_TASK_T* sched_current_task = NULL;
+
+/**
+ * @brief Currently elected task.
+ *
+ * @details Currently elected task, its context is loaded by the CPU context
+ * switch routine. This variable is used by the CPU context switch routine and
+ * must not be static.
+ */
+KERNEL_TASK_T* sched_next_task = NULL;
+
+/** @brief Ready tasks queue. */
+static READY_QUEUE_T ready_queue;
+
+/** @brief Sleeping tasks list, sorted by wakeup tick. */
+static KERNEL_TASK_T* sleep_list = NULL;
+
+/** @brief Stores the scheduler start state. */
+static uint8_t sched_started = 0;
+
+/** @brief Scheduler statistics. */
+static SCHED_STATS_T sched_stats;
+
+/** @brief Idle task control block. */
+static KERNEL_TASK_T idle_task;
+
+/** @brief Idle task stack. */
+static uint32_t idle_stack[CONFIG_SCHED_IDLE_STACK_SIZE / sizeof(uint32_t)];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Inserts the task in the sleeping list.
+ *
+ * @details Inserts the task in the sleeping list, sorted by wakeup tick. This
+ * must be called inside a kernel critical section.
+ *
+ * @param[in] task The task to insert.
+ */
+static void sched_sleep_insert(KERNEL_TASK_T* task)
+{
+    KERNEL_TASK_T** cursor;
+    KERNEL_TASK_T*  prev;
+
+    prev   = NULL;
+    cursor = &sleep_list;
+    while(*cursor != NULL &&
+          (int32_t)(task->wakeup_tick - (*cursor)->wakeup_tick) >= 0)
+    {
+        prev   = *cursor;
+        cursor = &(*cursor)->next;
+    }
+
+    task->state = TASK_STATE_SLEEPING;
+    task->prev  = prev;
+    task->next  = *cursor;
+    if(*cursor != NULL)
+    {
+        (*cursor)->prev = task;
+    }
+    *cursor = task;
+}
+
+/**
+ * @brief Removes the task from the sleeping list.
+ *
+ * @details Removes the task from the sleeping list if it belongs to it. This
+ * must be called inside a kernel critical section.
+ *
+ * @param[in] task The task to remove.
+ */
+static void sched_sleep_remove(KERNEL_TASK_T* task)
+{
+    if(task->prev == NULL && sleep_list != task)
+    {
+        return;
+    }
+
+    if(task->prev != NULL)
+    {
+        task->prev->next = task->next;
+    }
+    else
+    {
+        sleep_list = task->next;
+    }
+    if(task->next != NULL)
+    {
+        task->next->prev = task->prev;
+    }
+
+    task->next = NULL;
+    task->prev = NULL;
+}
+
+/**
+ * @brief Inserts the task in a wait queue.
+ *
+ * @details Inserts the task in a wait queue, after the waiting tasks of higher
+ * or equal priority. This must be called inside a kernel critical section.
+ *
+ * @param[in, out] queue The wait queue to update.
+ * @param[in] task The task to insert.
+ */
+static void sched_wait_queue_insert(KERNEL_WAIT_QUEUE_T* queue,
+                                    KERNEL_TASK_T* task)
+{
+    KERNEL_TASK_T** cursor;
+
+    cursor = &queue->head;
+    while(*cursor != NULL && (*cursor)->priority <= task->priority)
+    {
+        cursor = &(*cursor)->wait_next;
+    }
+
+    task->wait_queue = queue;
+    task->wait_next  = *cursor;
+    *cursor          = task;
+}
+
+/**
+ * @brief Removes the task from its wait queue.
+ *
+ * @details Removes the task from its wait queue. This must be called inside a
+ * kernel critical section.
+ *
+ * @param[in] task The task to remove.
+ */
+static void sched_wait_queue_remove(KERNEL_TASK_T* task)
+{
+    KERNEL_TASK_T** cursor;
+
+    if(task->wait_queue == NULL)
+    {
+        return;
+    }
+
+    cursor = &task->wait_queue->head;
+    while(*cursor != NULL && *cursor != task)
+    {
+        cursor = &(*cursor)->wait_next;
+    }
+    if(*cursor != NULL)
+    {
+        *cursor = task->wait_next;
+    }
+
+    task->wait_queue = NULL;
+    task->wait_next  = NULL;
+}
+
+/**
+ * @brief Wakes up the sleeping tasks that reached their wakeup tick.
+ *
+ * @details Wakes up the sleeping tasks that reached their wakeup tick, they
+ * are put back in the ready queue. The waiting tasks are removed from their
+ * wait queue with a timeout result.
+ */
+static void sched_wakeup_tasks(void)
+{
+    KERNEL_TASK_T* task;
+
+    while(sleep_list != NULL &&
+          (int32_t)(sched_stats.tick_count - sleep_list->wakeup_tick) >= 0)
+    {
+        task       = sleep_list;
+        sleep_list = task->next;
+        if(sleep_list != NULL)
+        {
+            sleep_list->prev = NULL;
+        }
+
+        if(task->state == TASK_STATE_WAITING)
+        {
+            sched_wait_queue_remove(task);
+            task->wait_result = ERROR_TIMEOUT;
+        }
+        ready_queue_push(&ready_queue, task);
+    }
+}
+
+/**
+ * @brief Elects the next task to run.
+ *
+ * @details Elects the next task to run. If the elected task is still running,
+ * it is put back in the ready queue after the tasks of the same priority. When
+ * the new elected task is not the one loaded on the CPU, the pending service
+ * exception is raised to perform the context switch. This must be called
+ * inside a kernel critical section.
+ */
+static void sched_elect(void)
+{
+    KERNEL_TASK_T* prev;
+    KERNEL_TASK_T* next;
+
+    prev = sched_next_task;
+    if(prev->state == TASK_STATE_RUNNING)
+    {
+        ready_queue_push(&ready_queue, prev);
+    }
+
+    next        = ready_queue_pop(&ready_queue);
+    next->state = TASK_STATE_RUNNING;
+    if(next != prev)
+    {
+        ++sched_stats.switch_count;
+        ++next->switch_count;
+    }
+
+    sched_next_task = next;
+    if(next != sched_current_task)
+    {
+        cpu_raise_pending_service();
+    }
+}
+
+/**
+ * @brief System tick interrupt handler.
+ *
+ * @details System tick interrupt handler. Updates the monotonic clock and the
+ * tick count, wakes up the sleeping tasks, runs the expired software timers 
+ * and elects the next task to run. The latency between the tick and the 
+ * election is recorded.
+ *
+ * @param[in] int_number The interrupt identifier.
+ * @param[in] stack The interrupted stack.
+ * @param[in] cpu_state The interrupted CPU state.
+ */
+static void sched_tick_handler(const INTERRUPT_ID_T int_number,
+                               const uintptr_t stack,
+                               const uintptr_t cpu_state)
+{
+    uint32_t cycles;
+
+    (void)int_number;
+    (void)stack;
+    (void)cpu_state;
+
+    cpu_timer_tick_update();
+    ++sched_stats.tick_count;
+
+    if(sched_started == 0)
+    {
+        return;
+    }
+
+    sched_wakeup_tasks();
+    kernel_timer_process(sched_stats.tick_count);
+    sched_elect();
+
+    if(cpu_timer_get_tick_elapsed(&cycles) == NO_ERROR)
+    {
+        sched_stats.last_latency = cycles;
+        if(cycles > sched_stats.max_latency)
+        {
+            sched_stats.max_latency = cycles;
+        }
+    }
+}
+
+/**
+ * @brief Terminates a task.
+ *
+ * @details Terminates a task, the task is removed from the scheduler lists,
+ * marked as dead and never elected again. When the task is the loaded task, 
+ * the loaded task is cleared so that its context is not saved by the context
+ * switch. The task may differ from the elected task when a context switch is
+ * pending. This must be called inside a kernel critical section.
+ *
+ * @param[in, out] task The task to terminate.
+ */
+static void sched_kill_task(KERNEL_TASK_T* task)
+{
+    KERNEL_TASK_STATE_T state;
+
+    state = task->state;
+    if(state == TASK_STATE_READY)
+    {
+        ready_queue_remove(&ready_queue, task);
+    }
+    else if(state == TASK_STATE_WAITING)
+    {
+        sched_wait_queue_remove(task);
+        sched_sleep_remove(task);
+    }
+    else if(state == TASK_STATE_SLEEPING)
+    {
+        sched_sleep_remove(task);
+    }
+    task->state = TASK_STATE_DEAD;
+
+    if(task == sched_current_task)
+    {
+        sched_current_task = NULL;
+    }
+
+    /* Replace the elected task, or switch away from the loaded task */
+    if(task == sched_next_task)
+    {
+        sched_elect();
+    }
+    else if(sched_current_task == NULL)
+    {
+        cpu_raise_pending_service();
+    }
+}
+
+/**
+ * @brief Task exit point.
+ *
+ * @details Task exit point, called when a privileged task returns from its 
+ * entry point. The task is marked as dead and never elected again.
+ */
+static void sched_task_exit(void)
+{
+    sched_exit();
+
+    /* We should never come back here */
+    while(1);
+}
+
+/**
+ * @brief Memory management fault handler.
+ *
+ * @details Memory management fault handler. A fault on the stack guard or 
+ * while stacking an exception frame is a stack overflow, any other fault is 
+ * an access violation. Faults raised by unprivileged tasks terminate the 
+ * task, other faults are fatal and the kernel panics.
+ *
+ * @param[in] int_number The interrupt identifier.
+ * @param[in] stack The interrupted stack.
+ * @param[in] cpu_state The interrupted CPU state.
+ */
+static void sched_mpu_fault_handler(const INTERRUPT_ID_T int_number,
+                                    const uintptr_t stack,
+                                    const uintptr_t cpu_state)
+{
+    uintptr_t      addr;
+    uintptr_t      fault[2];
+    uint8_t        on_stacking;
+    uint32_t       int_state;
+    ERROR_CODE_E   error;
+    KERNEL_TASK_T* task;
+
+    (void)int_number;
+    (void)stack;
+
+    task = sched_current_task;
+
+    if(cpu_mpu_get_fault(&addr, &on_stacking) != NO_ERROR)
+    {
+        addr = 0;
+    }
+
+    /* Only the guard region of the task's own stack is forbidden */
+    error = ERROR_ACCESS_VIOLATION;
+    if(on_stacking != 0 ||
+       (task != NULL &&
+        addr - (uintptr_t)task->stack_base < task->stack_size))
+    {
+        error = ERROR_STACK_OVERFLOW;
+    }
+
+    if(task == NULL)
+    {
+        KERNEL_LOG_ERROR("Kernel memory fault",
+                         (void*)&addr,
+                         sizeof(addr),
+                         error);
+        kernel_panic(error);
+    }
+
+    fault[0] = (uintptr_t)task->name;
+    fault[1] = addr;
+    KERNEL_LOG_ERROR("Task memory fault",
+                     (void*)fault,
+                     sizeof(fault),
+                     error);
+
+    if(task->unprivileged == 0 || cpu_interrupted_unprivileged(cpu_state) == 0)
+    {
+        kernel_panic(error);
+    }
+
+    /* Unprivileged task fault, the faulting task is terminated */
+    int_state = cpu_enter_critical();
+    sched_kill_task(task);
+    cpu_exit_critical(int_state);
+}
+
+#if CONFIG_SCHED_TICKLESS_IDLE == 1
+/**
+ * @brief Returns the number of ticks until the next scheduler deadline.
+ *
+ * @details Returns the number of ticks until the first sleeping task has to be
+ * woken up or the software timers wheel has to be processed. This must be 
+ * called inside a kernel critical section.
+ *
+ * @return The number of ticks until the next deadline is returned. UINT32_MAX
+ * is returned if no deadline is set.
+ */
+static uint32_t sched_get_idle_ticks(void)
+{
+    int32_t  ticks;
+    uint32_t timer_ticks;
+
+    timer_ticks = kernel_timer_get_idle_ticks(sched_stats.tick_count);
+
+    if(sleep_list == NULL)
+    {
+        return timer_ticks;
+    }
+
+    ticks = (int32_t)(sleep_list->wakeup_tick - sched_stats.tick_count);
+    if(ticks <= 0)
+    {
+        return 0;
+    }
+    if((uint32_t)ticks > timer_ticks)
+    {
+        return timer_ticks;
+    }
+
+    return (uint32_t)ticks;
+}
+#endif
+
+/**
+ * @brief Idle task routine.
+ *
+ * @details Idle task routine, elected when no other task is ready. The CPU is
+ * put to sleep until the next interrupt. In tickless mode, the system ticks
+ * are suppressed until the next deadline and the tick count is corrected on
+ * wake up. All the interrupts are masked while going to sleep, as the CPU is
+ * not woken up by the interrupts masked by a kernel critical section.
+ *
+ * @param[in] args Unused.
+ */
+static void sched_idle_task(void* args)
+{
+    uint32_t int_state;
+#if CONFIG_SCHED_TICKLESS_IDLE == 1
+    uint32_t elapsed;
+#endif
+
+    (void)args;
+
+    while(1)
+    {
+        int_state = cpu_disable_interrupts();
+
+        /* Only sleep if no task became ready */
+        if(ready_queue_top_priority(&ready_queue) ==
+           CONFIG_SCHED_PRIORITY_COUNT)
+        {
+#if CONFIG_SCHED_TICKLESS_IDLE == 1
+            if(cpu_timer_suppress_ticks(sched_get_idle_ticks(),
+                                        &elapsed) == NO_ERROR)
+            {
+                sched_stats.tick_count += elapsed;
+            }
+#else
+            cpu_wait_interrupt();
+#endif
+        }
+
+        cpu_restore_interrupts(int_state);
+    }
+}
+
+/**
+ * @brief Initializes a task and adds it to the ready queue.
+ *
+ * @details Initializes a task and adds it to the ready queue. If the new task
+ * has a higher priority than the current task, it preempts it.
+ *
+ * @param[out] task The task control block to initialize.
+ * @param[in] name The task's name.
+ * @param[in] priority The task's priority, 0 being the highest priority.
+ * @param[in] entry The task's entry point.
+ * @param[in] args The argument given to the task's entry point.
+ * @param[in] stack The base address of the task's stack.
+ * @param[in] stack_size The size in bytes of the task's stack.
+ * @param[in] unprivileged Set to 1 if the task runs unprivileged.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+static ERROR_CODE_E sched_init_task(KERNEL_TASK_T* task,
+                                    const char* name,
+                                    const uint8_t priority,
+                                    void (*entry)(void*),
+                                    void* args,
+                                    void* stack,
+                                    const size_t stack_size,
+                                    const uint8_t unprivileged)
+{
+    uint32_t     int_state;
+    ERROR_CODE_E error;
+
+    if(task == NULL || entry == NULL || stack == NULL)
+    {
+        KERNEL_LOG_ERROR("Task creation NULL parameter",
+                         NULL,
+                         0,
+                         ERROR_NULL_POINTER);
+        return ERROR_NULL_POINTER;
+    }
+    if(priority >= CONFIG_SCHED_PRIORITY_COUNT ||
+       stack_size < KERNEL_TASK_MIN_STACK_SIZE)
+    {
+        KERNEL_LOG_ERROR("Task creation invalid parameter",
+                         (void*)&priority,
+                         sizeof(priority),
+                         ERROR_INVALID_PARAM);
+        return ERROR_INVALID_PARAM;
+    }
+
+    task->stack_base   = stack;
+    task->stack_size   = stack_size;
+    task->priority     = priority;
+    task->name         = name;
+    task->entry        = entry;
+    task->args         = args;
+    task->wakeup_tick  = 0;
+    task->switch_count = 0;
+    task->next         = NULL;
+    task->prev         = NULL;
+    task->unprivileged = unprivileged;
+    task->wait_queue   = NULL;
+    task->wait_next    = NULL;
+    task->wait_result  = NO_ERROR;
+    task->wait_data    = 0;
+
+    task->base_priority  = priority;
+    task->blocking_mutex = NULL;
+    task->held_mutexes   = NULL;
+
+    /* The guard region covers the bottom of the stack */
+    error = cpu_mpu_get_stack_guard((uintptr_t)stack, &task->stack_guard);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+    error = cpu_mpu_get_stack_region((uintptr_t)stack, 
+                                     stack_size, 
+                                     unprivileged,
+                                     &task->stack_region);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    /* Unprivileged tasks exit through a system call */
+    task->stack_pointer = cpu_init_context((uintptr_t)stack + stack_size,
+                                           entry,
+                                           args,
+                                           unprivileged != 0 ? 
+                                           sys_exit : sched_task_exit);
+
+    int_state = cpu_enter_critical();
+    ready_queue_push(&ready_queue, task);
+
+    /* Preempt the elected task if the new task has a higher priority */
+    if(sched_started != 0 && priority < sched_next_task->priority)
+    {
+        sched_elect();
+    }
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E sched_init(void)
+{
+    ERROR_CODE_E error;
+
+    sleep_list         = NULL;
+    sched_current_task = NULL;
+    sched_next_task    = NULL;
+    sched_started      = 0;
+
+    sched_stats.tick_count   = 0;
+    sched_stats.switch_count = 0;
+    sched_stats.last_latency = 0;
+    sched_stats.max_latency  = 0;
+
+    kernel_timer_wheel_init(sched_stats.tick_count);
+
+    error = ready_queue_init(&ready_queue);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    error = kernel_interrupt_register_handler(INT_SYS_TICK_ID,
+                                              sched_tick_handler);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    error = kernel_interrupt_register_handler(INT_MPU_FAULT_ID,
+                                              sched_mpu_fault_handler);
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    /* Create the idle task */
+    error = sched_create_task(&idle_task, "idle", KERNEL_LOWEST_PRIORITY,
+                              sched_idle_task, NULL,
+                              idle_stack, sizeof(idle_stack));
+    if(error != NO_ERROR)
+    {
+        return error;
+    }
+
+    KERNEL_LOG_INFO("Scheduler initialized", NULL, 0, NO_ERROR);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E sched_create_task(KERNEL_TASK_T* task,
+                               const char* name,
+                               const uint8_t priority,
+                               void (*entry)(void*),
+                               void* args,
+                               void* stack,
+                               const size_t stack_size)
+{
+    return sched_init_task(task, name, priority, entry, args, 
+                           stack, stack_size, 0);
+}
+
+ERROR_CODE_E sched_create_user_task(KERNEL_TASK_T* task,
+                                    const char* name,
+                                    const uint8_t priority,
+                                    void (*entry)(void*),
+                                    void* args,
+                                    void* stack,
+                                    const size_t stack_size)
+{
+    return sched_init_task(task, name, priority, entry, args, 
+                           stack, stack_size, 1);
+}
+
+void sched_start(void)
+{
+    (void)cpu_disable_interrupts();
+
+    sched_current_task        = ready_queue_pop(&ready_queue);
+    sched_current_task->state = TASK_STATE_RUNNING;
+    ++sched_current_task->switch_count;
+    sched_next_task           = sched_current_task;
+    sched_started             = 1;
+
+    KERNEL_LOG_INFO("Scheduler started", NULL, 0, NO_ERROR);
+
+    cpu_mpu_set_stack_region(&sched_current_task->stack_region);
+    cpu_mpu_set_stack_guard(sched_current_task->stack_guard);
+    cpu_start_first_context(sched_current_task->stack_pointer,
+                            sched_current_task->unprivileged);
+}
+
+void sched_yield(void)
+{
+    uint32_t int_state;
+
+    if(sched_started != 0)
+    {
+        int_state = cpu_enter_critical();
+        sched_elect();
+        cpu_exit_critical(int_state);
+    }
+}
+
+void sched_sleep(const uint32_t ticks)
+{
+    uint32_t int_state;
+
+    if(sched_started == 0)
+    {
+        return;
+    }
+
+    int_state = cpu_enter_critical();
+    if(ticks != 0)
+    {
+        sched_next_task->wakeup_tick = sched_stats.tick_count + ticks;
+        sched_sleep_insert(sched_next_task);
+    }
+    sched_elect();
+    cpu_exit_critical(int_state);
+}
+
+ERROR_CODE_E sched_wait_queue_init(KERNEL_WAIT_QUEUE_T* queue)
+{
+    if(queue == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    queue->head = NULL;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E sched_wait(KERNEL_WAIT_QUEUE_T* queue,
+                        const uint32_t timeout,
+                        const uint32_t int_state)
+{
+    return sched_wait_data(queue, timeout, 0, int_state);
+}
+
+ERROR_CODE_E sched_wait_data(KERNEL_WAIT_QUEUE_T* queue,
+                             const uint32_t timeout,
+                             const uintptr_t wait_data,
+                             const uint32_t int_state)
+{
+    KERNEL_TASK_T* task;
+
+    if(timeout == 0)
+    {
+        cpu_exit_critical(int_state);
+        return ERROR_TIMEOUT;
+    }
+    if(sched_started == 0 || cpu_is_interrupt() != 0)
+    {
+        cpu_exit_critical(int_state);
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    task              = sched_next_task;
+    task->wait_result = ERROR_TIMEOUT;
+    task->wait_data   = wait_data;
+    sched_wait_queue_insert(queue, task);
+
+    if(timeout != KERNEL_WAIT_FOREVER)
+    {
+        task->wakeup_tick = sched_stats.tick_count + timeout;
+        sched_sleep_insert(task);
+    }
+    else
+    {
+        task->next = NULL;
+        task->prev = NULL;
+    }
+    task->state = TASK_STATE_WAITING;
+
+    /* The context switch happens when exiting the critical section */
+    sched_elect();
+    cpu_exit_critical(int_state);
+
+    return task->wait_result;
+}
+
+void sched_wake_task(KERNEL_TASK_T* task, const ERROR_CODE_E result)
+{
+    if(task->state != TASK_STATE_WAITING)
+    {
+        return;
+    }
+
+    sched_wait_queue_remove(task);
+    sched_sleep_remove(task);
+
+    task->wait_result = result;
+    ready_queue_push(&ready_queue, task);
+
+    /* Preempt the elected task if the woken task has a higher priority */
+    if(sched_started != 0 && task->priority < sched_next_task->priority)
+    {
+        sched_elect();
+    }
+}
+
+KERNEL_TASK_T* sched_wake_one(KERNEL_WAIT_QUEUE_T* queue, 
+                              const ERROR_CODE_E result)
+{
+    KERNEL_TASK_T* task;
+
+    task = queue->head;
+    if(task != NULL)
+    {
+        sched_wake_task(task, result);
+    }
+
+    return task;
+}
+
+void sched_set_priority(KERNEL_TASK_T* task, const uint8_t priority)
+{
+    KERNEL_WAIT_QUEUE_T* queue;
+
+    if(task->priority == priority)
+    {
+        return;
+    }
+
+    if(task->state == TASK_STATE_READY)
+    {
+        ready_queue_remove(&ready_queue, task);
+        task->priority = priority;
+        ready_queue_push(&ready_queue, task);
+    }
+    else if(task->state == TASK_STATE_WAITING && task->wait_queue != NULL)
+    {
+        queue = task->wait_queue;
+        sched_wait_queue_remove(task);
+        task->priority = priority;
+        sched_wait_queue_insert(queue, task);
+    }
+    else
+    {
+        task->priority = priority;
+    }
+
+    /* Preempt the elected task if a ready task now has a higher priority */
+    if(sched_started != 0 &&
+       ready_queue_top_priority(&ready_queue) < sched_next_task->priority)
+    {
+        sched_elect();
+    }
+}
+
+void sched_exit(void)
+{
+    uint32_t int_state;
+
+    int_state = cpu_enter_critical();
+    sched_kill_task(sched_current_task);
+    cpu_exit_critical(int_state);
+}
+
+KERNEL_TASK_T* sched_get_current_task(void)
+{
+    return sched_next_task;
+}
+
+uint32_t sched_get_tick(void)
+{
+    return sched_stats.tick_count;
+}
+
+ERROR_CODE_E sched_get_stats(SCHED_STATS_T* stats)
+{
+    uint32_t int_state;
+
+    if(stats == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+    *stats = sched_stats;
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
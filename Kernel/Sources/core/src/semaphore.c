@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * @file semaphore.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel counting semaphores.
+ *
+ * @details Kernel counting semaphores. The counter holds the available units
+ * minus the number of waiting tasks. The fast paths update a positive counter
+ * with the CPU atomic compare and swap. The slow paths run inside a kernel 
+ * critical section: a waiter decrements the counter below zero before 
+ * waiting, a giver that finds a negative counter hands the unit to the first 
+ * waiter.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "cpu_atomic.h"
+#include "scheduler.h"
+#include "semaphore.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Atomic compare and swap on the semaphore counter.
+ *
+ * @param[in, out] sem The semaphore to update.
+ * @param[in] expected The expected counter value.
+ * @param[in] desired The counter value to store.
+ *
+ * @return 1 is returned if the counter was updated, 0 otherwise.
+ */
+static uint32_t kernel_sem_cas(KERNEL_SEMAPHORE_T* sem, 
+                               const int32_t expected,
+                               const int32_t desired)
+{
+    return cpu_atomic_cas((volatile uint32_t*)&sem->count, 
+                          (uint32_t)expected, 
+                          (uint32_t)desired) == (uint32_t)expected;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E kernel_sem_init(KERNEL_SEMAPHORE_T* sem, 
+                             const char* name,
+                             const int32_t count)
+{
+    if(sem == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(count < 0)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+
+    sem->name  = name;
+    sem->count = count;
+
+    return sched_wait_queue_init(&sem->waiters);
+}
+
+ERROR_CODE_E kernel_sem_take(KERNEL_SEMAPHORE_T* sem, const uint32_t timeout)
+{
+    int32_t      count;
+    uint32_t     int_state;
+    ERROR_CODE_E error;
+
+    if(sem == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    /* Fast path, a unit is available */
+    count = sem->count;
+    while(count > 0)
+    {
+        if(kernel_sem_cas(sem, count, count - 1) != 0)
+        {
+            return NO_ERROR;
+        }
+        count = sem->count;
+    }
+
+    int_state = cpu_enter_critical();
+
+    /* A unit may have been given in between */
+    count = sem->count;
+    if(count > 0)
+    {
+        sem->count = count - 1;
+        cpu_exit_critical(int_state);
+        return NO_ERROR;
+    }
+    if(timeout == 0)
+    {
+        cpu_exit_critical(int_state);
+        return ERROR_TIMEOUT;
+    }
+
+    /* Register as waiter, the giver hands the unit to us */
+    sem->count = count - 1;
+    error = sched_wait(&sem->waiters, timeout, int_state);
+    if(error != NO_ERROR)
+    {
+        int_state = cpu_enter_critical();
+        ++sem->count;
+        cpu_exit_critical(int_state);
+    }
+
+    return error;
+}
+
+ERROR_CODE_E kernel_sem_give(KERNEL_SEMAPHORE_T* sem)
+{
+    int32_t  count;
+    uint32_t int_state;
+
+    if(sem == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    /* Fast path, no task waits */
+    count = sem->count;
+    while(count >= 0)
+    {
+        if(kernel_sem_cas(sem, count, count + 1) != 0)
+        {
+            return NO_ERROR;
+        }
+        count = sem->count;
+    }
+
+    int_state = cpu_enter_critical();
+
+    count      = sem->count;
+    sem->count = count + 1;
+    if(count < 0)
+    {
+        (void)sched_wake_one(&sem->waiters, NO_ERROR);
+    }
+
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
@@ -0,0 +1,430 @@
+/*******************************************************************************
+ * @file sw_timer.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel software timers.
+ *
+ * @details Kernel software timers. The timers are kept in a hierarchical 
+ * timing wheel of SW_TIMER_WHEEL_LEVELS levels of SW_TIMER_WHEEL_SLOTS slots.
+ * A timer is stored in the lowest level able to hold its remaining delay, in 
+ * the slot selected by the matching bits of its expiry tick. Each tick runs a
+ * single level 0 slot. When the level 0 index wraps, the current slot of the
+ * next level is cascaded to the lower levels. Each slot is a doubly linked 
+ * list so that a timer is removed in constant time, and each level keeps a 
+ * bitmap of its used slots to compute the next deadline.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "scheduler.h"
+#include "sw_timer.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Wheel slots, each slot is a list of timers. */
+static KERNEL_TIMER_T* 
+    timer_wheel[SW_TIMER_WHEEL_LEVELS][SW_TIMER_WHEEL_SLOTS];
+
+/** @brief Number of 32 bits words in a level used slots bitmap. */
+#define SW_TIMER_BITMAP_WORDS ((SW_TIMER_WHEEL_SLOTS + 31) / 32)
+
+/** 
+ * @brief Used slots bitmap of each wheel level, kept in 32 bits words so the
+ * scans do not need 64 bits operations.
+ */
+static uint32_t 
+    timer_wheel_bitmap[SW_TIMER_WHEEL_LEVELS][SW_TIMER_BITMAP_WORDS];
+
+/** @brief Next tick to be processed by the wheel. */
+static uint32_t timer_wheel_tick;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Inserts a timer in the wheel.
+ *
+ * @details Inserts a timer in the wheel slot matching its expiry tick. Timers
+ * that expired are inserted in the next processed slot. This must be called
+ * inside a kernel critical section.
+ *
+ * @param[in, out] timer The timer to insert.
+ */
+static void kernel_timer_insert(KERNEL_TIMER_T* timer)
+{
+    KERNEL_TIMER_T** head;
+    uint32_t         delta;
+    uint32_t         place;
+    uint32_t         level;
+    uint32_t         slot;
+
+    place = timer->expiry;
+    delta = place - timer_wheel_tick;
+
+    if((int32_t)delta < 0)
+    {
+        place = timer_wheel_tick;
+        delta = 0;
+    }
+    else if(delta >= SW_TIMER_WHEEL_RANGE)
+    {
+        /* Park the timer at the end of the wheel, it is cascaded again */
+        delta = SW_TIMER_WHEEL_RANGE - 1;
+        place = timer_wheel_tick + delta;
+    }
+
+    level = 0;
+    while((delta >> (SW_TIMER_WHEEL_BITS * (level + 1))) != 0)
+    {
+        ++level;
+    }
+    slot = (place >> (SW_TIMER_WHEEL_BITS * level)) & 
+           (SW_TIMER_WHEEL_SLOTS - 1);
+
+    head = &timer_wheel[level][slot];
+
+    timer->level = (uint8_t)level;
+    timer->slot  = (uint8_t)slot;
+    timer->next  = *head;
+    timer->pprev = head;
+    if(*head != NULL)
+    {
+        (*head)->pprev = &timer->next;
+    }
+    *head = timer;
+
+    timer_wheel_bitmap[level][slot >> 5] |= 1U << (slot & 31);
+}
+
+/**
+ * @brief Removes a timer from the wheel.
+ *
+ * @details Removes a timer from its wheel slot. This must be called inside a 
+ * kernel critical section.
+ *
+ * @param[in, out] timer The timer to remove.
+ */
+static void kernel_timer_remove(KERNEL_TIMER_T* timer)
+{
+    *timer->pprev = timer->next;
+    if(timer->next != NULL)
+    {
+        timer->next->pprev = timer->pprev;
+    }
+
+    if(timer_wheel[timer->level][timer->slot] == NULL)
+    {
+        timer_wheel_bitmap[timer->level][timer->slot >> 5] &= 
+            ~(1U << (timer->slot & 31));
+    }
+
+    timer->next  = NULL;
+    timer->pprev = NULL;
+}
+
+/**
+ * @brief Cascades a wheel slot to the lower levels.
+ *
+ * @details Cascades a wheel slot, its timers are inserted again relative to 
+ * the current wheel tick and end up in the lower levels. This must be called
+ * inside a kernel critical section.
+ *
+ * @param[in] level The level of the slot to cascade.
+ * @param[in] slot The slot to cascade.
+ */
+static void kernel_timer_cascade(const uint32_t level, const uint32_t slot)
+{
+    KERNEL_TIMER_T* timer;
+
+    while((timer = timer_wheel[level][slot]) != NULL)
+    {
+        kernel_timer_remove(timer);
+        kernel_timer_insert(timer);
+    }
+}
+
+/**
+ * @brief Tells if a wheel level holds timers.
+ *
+ * @param[in] level The wheel level to check.
+ *
+ * @return 1 is returned if a slot of the level is used, 0 otherwise.
+ */
+static uint32_t kernel_timer_level_used(const uint32_t level)
+{
+    uint32_t i;
+
+    for(i = 0; i < SW_TIMER_BITMAP_WORDS; ++i)
+    {
+        if(timer_wheel_bitmap[level][i] != 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Tells if the wheel holds no timer.
+ *
+ * @return 1 is returned if no timer is armed, 0 otherwise.
+ */
+static uint32_t kernel_timer_wheel_empty(void)
+{
+    uint32_t level;
+
+    for(level = 0; level < SW_TIMER_WHEEL_LEVELS; ++level)
+    {
+        if(kernel_timer_level_used(level) != 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Gets the distance to the next used level 0 slot.
+ *
+ * @details Scans the level 0 bitmap from the slot index, wrapping around the
+ * level, for the first used slot. This must be called inside a kernel 
+ * critical section.
+ *
+ * @param[in] index The slot index to start from.
+ *
+ * @return The number of slots from the index to the first used slot is 
+ * returned, UINT32_MAX if level 0 is empty.
+ */
+static uint32_t kernel_timer_next_slot(const uint32_t index)
+{
+    uint32_t bits;
+    uint32_t word;
+    uint32_t i;
+
+    /* The index word is visited twice: from the index, then below it */
+    for(i = 0; i <= SW_TIMER_BITMAP_WORDS; ++i)
+    {
+        word = ((index >> 5) + i) % SW_TIMER_BITMAP_WORDS;
+        bits = timer_wheel_bitmap[0][word];
+        if(i == 0)
+        {
+            bits &= ~0U << (index & 31);
+        }
+        else if(i == SW_TIMER_BITMAP_WORDS)
+        {
+            bits &= ~(~0U << (index & 31));
+        }
+
+        if(bits != 0)
+        {
+            return (((word << 5) + (uint32_t)__builtin_ctz(bits)) - index) & 
+                   (SW_TIMER_WHEEL_SLOTS - 1);
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+void kernel_timer_wheel_init(const uint32_t tick)
+{
+    uint32_t level;
+    uint32_t slot;
+
+    for(level = 0; level < SW_TIMER_WHEEL_LEVELS; ++level)
+    {
+        for(slot = 0; slot < SW_TIMER_WHEEL_SLOTS; ++slot)
+        {
+            timer_wheel[level][slot] = NULL;
+        }
+        for(slot = 0; slot < SW_TIMER_BITMAP_WORDS; ++slot)
+        {
+            timer_wheel_bitmap[level][slot] = 0;
+        }
+    }
+
+    timer_wheel_tick = tick + 1;
+}
+
+ERROR_CODE_E kernel_timer_init(KERNEL_TIMER_T* timer,
+                               const char* name,
+                               void (*callback)(void*),
+                               void* args)
+{
+    if(timer == NULL || callback == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    timer->next     = NULL;
+    timer->pprev    = NULL;
+    timer->expiry   = 0;
+    timer->period   = 0;
+    timer->level    = 0;
+    timer->slot     = 0;
+    timer->name     = name;
+    timer->callback = callback;
+    timer->args     = args;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kernel_timer_start(KERNEL_TIMER_T* timer,
+                                const uint32_t delay,
+                                const uint32_t period)
+{
+    uint32_t int_state;
+
+    if(timer == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(delay == 0)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+
+    int_state = cpu_enter_critical();
+
+    if(timer->pprev != NULL)
+    {
+        kernel_timer_remove(timer);
+    }
+
+    timer->expiry = sched_get_tick() + delay;
+    timer->period = period;
+    kernel_timer_insert(timer);
+
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E kernel_timer_stop(KERNEL_TIMER_T* timer)
+{
+    uint32_t int_state;
+
+    if(timer == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    int_state = cpu_enter_critical();
+
+    if(timer->pprev != NULL)
+    {
+        kernel_timer_remove(timer);
+    }
+    timer->period = 0;
+
+    cpu_exit_critical(int_state);
+
+    return NO_ERROR;
+}
+
+uint32_t kernel_timer_is_active(const KERNEL_TIMER_T* timer)
+{
+    return (timer != NULL && timer->pprev != NULL) ? 1 : 0;
+}
+
+void kernel_timer_process(const uint32_t tick)
+{
+    KERNEL_TIMER_T* timer;
+    uint32_t        level;
+    uint32_t        index;
+
+    /* Nothing to process, jump to the current tick */
+    if(kernel_timer_wheel_empty() != 0)
+    {
+        timer_wheel_tick = tick + 1;
+        return;
+    }
+
+    while((int32_t)(tick - timer_wheel_tick) >= 0)
+    {
+        /* Cascade the higher levels when the lower level index wraps */
+        level = 0;
+        index = timer_wheel_tick & (SW_TIMER_WHEEL_SLOTS - 1);
+        while(index == 0 && level + 1 < SW_TIMER_WHEEL_LEVELS)
+        {
+            ++level;
+            index = (timer_wheel_tick >> (SW_TIMER_WHEEL_BITS * level)) &
+                    (SW_TIMER_WHEEL_SLOTS - 1);
+            kernel_timer_cascade(level, index);
+        }
+
+        /* Run the expired timers, the callbacks may start or stop timers */
+        index = timer_wheel_tick & (SW_TIMER_WHEEL_SLOTS - 1);
+        while((timer = timer_wheel[0][index]) != NULL)
+        {
+            kernel_timer_remove(timer);
+            if(timer->period != 0)
+            {
+                timer->expiry += timer->period;
+                kernel_timer_insert(timer);
+            }
+            timer->callback(timer->args);
+        }
+
+        ++timer_wheel_tick;
+    }
+}
+
+uint32_t kernel_timer_get_idle_ticks(const uint32_t tick)
+{
+    uint32_t index;
+    uint32_t distance;
+    uint32_t slot;
+    uint32_t level;
+    int32_t  ticks;
+
+    if(kernel_timer_wheel_empty() != 0)
+    {
+        return UINT32_MAX;
+    }
+
+    /* The next cascade bounds the deadline when higher levels are used */
+    index    = timer_wheel_tick & (SW_TIMER_WHEEL_SLOTS - 1);
+    distance = (SW_TIMER_WHEEL_SLOTS - index) & (SW_TIMER_WHEEL_SLOTS - 1);
+    for(level = 1; level < SW_TIMER_WHEEL_LEVELS; ++level)
+    {
+        if(kernel_timer_level_used(level) != 0)
+        {
+            break;
+        }
+    }
+    if(level == SW_TIMER_WHEEL_LEVELS)
+    {
+        distance = UINT32_MAX;
+    }
+
+    /* First used level 0 slot from the current index */
+    slot = kernel_timer_next_slot(index);
+    if(slot < distance)
+    {
+        distance = slot;
+    }
+
+    ticks = (int32_t)(timer_wheel_tick + distance - tick);
+    if(ticks <= 0)
+    {
+        return 0;
+    }
+
+    return (uint32_t)ticks;
+}
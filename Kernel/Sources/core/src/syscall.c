@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * @file syscall.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Kernel system calls.
+ *
+ * @details Kernel system calls. This module implements the kernel side of the
+ * system calls and their jump table. The routines are executed in handler 
+ * mode at the system call exception priority.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "scheduler.h"
+#include "syscall.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Yield system call routine.
+ *
+ * @param[in] arg0 Unused.
+ * @param[in] arg1 Unused.
+ * @param[in] arg2 Unused.
+ * @param[in] arg3 Unused.
+ *
+ * @return NO_ERROR is always returned.
+ */
+static uint32_t syscall_yield(const uint32_t arg0,
+                              const uint32_t arg1,
+                              const uint32_t arg2,
+                              const uint32_t arg3)
+{
+    (void)arg0;
+    (void)arg1;
+    (void)arg2;
+    (void)arg3;
+
+    sched_yield();
+
+    return NO_ERROR;
+}
+
+/**
+ * @brief Sleep system call routine.
+ *
+ * @param[in] arg0 The number of system ticks to sleep.
+ * @param[in] arg1 Unused.
+ * @param[in] arg2 Unused.
+ * @param[in] arg3 Unused.
+ *
+ * @return NO_ERROR is always returned.
+ */
+static uint32_t syscall_sleep(const uint32_t arg0,
+                              const uint32_t arg1,
+                              const uint32_t arg2,
+                              const uint32_t arg3)
+{
+    (void)arg1;
+    (void)arg2;
+    (void)arg3;
+
+    sched_sleep(arg0);
+
+    return NO_ERROR;
+}
+
+/**
+ * @brief Get tick system call routine.
+ *
+ * @param[in] arg0 Unused.
+ * @param[in] arg1 Unused.
+ * @param[in] arg2 Unused.
+ * @param[in] arg3 Unused.
+ *
+ * @return The system tick count is returned.
+ */
+static uint32_t syscall_get_tick(const uint32_t arg0,
+                                 const uint32_t arg1,
+                                 const uint32_t arg2,
+                                 const uint32_t arg3)
+{
+    SCHED_STATS_T stats;
+
+    (void)arg0;
+    (void)arg1;
+    (void)arg2;
+    (void)arg3;
+
+    if(sched_get_stats(&stats) != NO_ERROR)
+    {
+        return 0;
+    }
+
+    return stats.tick_count;
+}
+
+/**
+ * @brief Exit system call routine.
+ *
+ * @param[in] arg0 Unused.
+ * @param[in] arg1 Unused.
+ * @param[in] arg2 Unused.
+ * @param[in] arg3 Unused.
+ *
+ * @return NO_ERROR is always returned, the calling task is never resumed.
+ */
+static uint32_t syscall_exit(const uint32_t arg0,
+                             const uint32_t arg1,
+                             const uint32_t arg2,
+                             const uint32_t arg3)
+{
+    (void)arg0;
+    (void)arg1;
+    (void)arg2;
+    (void)arg3;
+
+    sched_exit();
+
+    return NO_ERROR;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+const SYSCALL_HANDLER_T kernel_syscall_table[SYSCALL_COUNT] = {
+    [SYSCALL_YIELD]    = syscall_yield,
+    [SYSCALL_SLEEP]    = syscall_sleep,
+    [SYSCALL_GET_TICK] = syscall_get_tick,
+    [SYSCALL_EXIT]     = syscall_exit
+};
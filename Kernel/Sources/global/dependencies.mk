@@ -1,9 +1,11 @@
-DEP_INCLUDES=
-
-DEP_LIBS= -larch
-DEP_LIBS+= -lcore
-DEP_LIBS+= -lio
-
-DEP_MODULES = -L../arch/bin
-DEP_MODULES += -L../core/bin
-DEP_MODULES += -L../io/bin
\ No newline at end of file
+DEP_INCLUDES=
+
+DEP_LIBS= -larch
+DEP_LIBS+= -lcore
+DEP_LIBS+= -lio
+DEP_LIBS+= -llib
+
+DEP_MODULES = -L../arch/bin
+DEP_MODULES += -L../core/bin
+DEP_MODULES += -L../io/bin
+DEP_MODULES += -L../lib/bin
\ No newline at end of file
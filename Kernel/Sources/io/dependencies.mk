@@ -1,5 +1,6 @@
-DEP_INCLUDES= -I ../types/includes
-DEP_INCLUDES+= -I ../arch/board/includes
-DEP_INCLUDES+= -I ../lib/includes/
-
+DEP_INCLUDES= -I ../types/includes
+DEP_INCLUDES+= -I ../arch/board/includes
+DEP_INCLUDES+= -I ../lib/includes/
+DEP_INCLUDES+= -I ../arch/cpu/includes/
+
 DEP_LIBS=
\ No newline at end of file
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * @file crash_log.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Retained crash log module.
+ *
+ * @details Retained crash log module. The log records are copied to a
+ * circular buffer located in the .noinit section, which is not cleared at
+ * reset. A kernel panic stores a panic record next to it. On the next boot,
+ * the log and the panic record are detected and sent to the log output. The
+ * module is only available when CONFIG_CRASH_LOG_ENABLED is set.
+ ******************************************************************************/
+
+#ifndef __IO_CRASH_LOG_H__
+#define __IO_CRASH_LOG_H__
+
+#include "error_types.h"
+#include "stdint.h"
+#include "stddef.h"
+#include "types.h"
+#include "logger.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/** @brief Retained log validity magic ("LUTC"). */
+#define CRASH_LOG_MAGIC 0x4C555443
+
+/** @brief Panic record validity magic ("PANC"). */
+#define CRASH_LOG_PANIC_MAGIC 0x50414E43
+
+/** @brief Number of CPU specific fault state words in the panic record. */
+#define CRASH_LOG_CPU_STATE_SIZE 4
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Panic record, retained across the reset. */
+struct CRASH_LOG_PANIC
+{
+    /** @brief Set to CRASH_LOG_PANIC_MAGIC when the record is valid. */
+    uint32_t magic;
+    /** @brief Panic reason. */
+    uint32_t reason;
+    /** @brief Address the panic routine was called from. */
+    uint32_t caller;
+    /** @brief Panic time in units of 1024 nanoseconds. */
+    uint32_t time;
+    /** @brief CPU specific fault state, such as the fault status registers. */
+    uint32_t cpu_state[CRASH_LOG_CPU_STATE_SIZE];
+};
+
+/** @brief Short hand for struct CRASH_LOG_PANIC */
+typedef struct CRASH_LOG_PANIC CRASH_LOG_PANIC_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes the retained crash log.
+ *
+ * @details Initializes the retained crash log. If the retained memory holds a
+ * panic record from the previous run, the log is kept and the recording is
+ * suspended until crash_log_flush is called. Otherwise the log is cleared and
+ * the recording starts. This must be called before any log is emitted.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E crash_log_init(void);
+
+/**
+ * @brief Copies a log record to the retained crash log.
+ *
+ * @details Copies a log record to the retained crash log, overwriting the
+ * oldest records when the log is full. This function can be called from the
+ * tasks and the interrupts managed by the kernel, but not from the 
+ * interrupts above the kernel priority ceiling.
+ *
+ * @param[in] vector The buffers forming the record.
+ * @param[in] count The number of buffers in the vector.
+ */
+void crash_log_write(const IO_VECTOR_T* vector, const size_t count);
+
+/**
+ * @brief Stores the panic record in the retained memory.
+ *
+ * @details Stores the panic record in the retained memory. The record magic
+ * and time are set by this function. This is intended to be called by the
+ * kernel panic routine with interrupts disabled.
+ *
+ * @param[in] record The panic record to store.
+ */
+void crash_log_set_panic(const CRASH_LOG_PANIC_T* record);
+
+/**
+ * @brief Gets the panic record of the previous run.
+ *
+ * @param[out] record The pointer to store the panic record.
+ *
+ * @return NO_ERROR is returned if a panic record was retained.
+ * ERROR_NOT_AVAILABLE is returned otherwise. Please refer to the list of the
+ * standard error codes.
+ */
+ERROR_CODE_E crash_log_get_panic(CRASH_LOG_PANIC_T* record);
+
+/**
+ * @brief Sends the retained crash log of the previous run.
+ *
+ * @details Sends the retained crash log of the previous run to the log sink
+ * in a single call, oldest record first, then clears the retained memory and
+ * starts the recording. When the log wrapped, the oldest record may be cut.
+ *
+ * @param[in] settings The logger settings holding the log sink.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_NOT_AVAILABLE is
+ * returned if no crash log was retained. Otherwise an error code is returned.
+ * Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E crash_log_flush(const LOGGER_SETTINGS_T* settings);
+
+#endif /* #ifndef __IO_CRASH_LOG_H__ */
@@ -10,28 +10,70 @@
  * @brief Kernel logger module.
  *
  * @details Kernel logger module. This module is used to report info, warnings
- * and errors happening in the kernel.
+ * and errors happening in the kernel. When CONFIG_LOG_BINARY is set, the logs
+ * are sent as binary frames holding the message identifier instead of the 
+ * message text. The messages are stored in the .log_strings section, which is
+ * not loaded in the target memory, and are recovered by the host log decoder
+ * from the kernel ELF file.
  ******************************************************************************/
 
 #ifndef __IO_LOGGER_H__
 #define __IO_LOGGER_H__
 
 #include "error_types.h"
+#include "stdint.h"
 #include "stddef.h"
+#include "types.h"
 #include "config.h"
 
 /*******************************************************************************
  * DEFINES
  ******************************************************************************/
 
+#if CONFIG_LOG_BINARY == 1
+
+/** @brief Binary log frame synchronization byte. */
+#define LOGGER_BINARY_SYNC 0xA5
+
+/** @brief Binary log frame header size in bytes. */
+#define LOGGER_BINARY_HEADER_SIZE 9
+
+/** @brief Maximal number of data bytes in a binary log frame. */
+#define LOGGER_BINARY_MAX_DATA 63
+
+/** 
+ * @brief Places a log message in the .log_strings section and returns it. The
+ * message must be a string literal.
+ */
+#define KERNEL_LOG_STRING(msg) ({                                   \
+    static const char log_string[]                                  \
+        __attribute__((section(".log_strings"), used)) = msg;       \
+    log_string;                                                     \
+})
+
+#else
+
+/** @brief Maximal number of data bytes in a text log line. */
+#define LOGGER_TEXT_MAX_DATA 32
+
+#endif
+
 /*******************************************************************************
  * STRUCTURES
  ******************************************************************************/
 
+/** @brief Logger settings structure. */
 struct LOGGER_SETTINGS
 {
-    void(*logger_buffer_write)(const char* str, const size_t length);
+    /** 
+     * @brief Log sink, called once per log record with the buffers forming
+     * the record. The buffers must be written in order and not interleaved 
+     * with other records.
+     */
+    void(*logger_buffer_writev)(const IO_VECTOR_T* vector, const size_t count);
 };
+
+/** @brief Short hand for struct LOGGER_SETTINGS */
 typedef struct LOGGER_SETTINGS LOGGER_SETTINGS_T;
 
 /*******************************************************************************
@@ -40,62 +82,107 @@ typedef struct LOGGER_SETTINGS LOGGER_SETTINGS_T;
 
 ERROR_CODE_E logger_init(const LOGGER_SETTINGS_T* settings);
 
-#if KERNEL_LOG_LEVEL >= INFO_LOG_LEVEL
-    /** 
-     * @brief Logs an information message to the log buffer.
-     * 
-     * @details Logs an information message to the log buffer. The logger must 
-     * be initialized before calling this function. Otherwise thins function has
-     * no effect.
-     * 
-     * @param[in] msg The message to log.
-     * @param[in] data The data to log.
-     * @param[in] data_size The size of the data to log.
-     * @param[in] state The state to log.
-     */
-    void KERNEL_LOG_INFO(const char* msg, const void* data, 
-                         const size_t data_size, const ERROR_CODE_E state);
-#else 
-    #define KERNEL_LOG_INFO(a, b, c, d) ({(void)a; (void)b; (void)c; (void)d;})
-#endif
-#if KERNEL_LOG_LEVEL >= WARNING_LOG_LEVEL
-    /** 
-     * @brief Logs a warning message to the log buffer.
-     * 
-     * @details Logs an warning message to the log buffer. The logger must 
-     * be initialized before calling this function. Otherwise thins function has
-     * no effect.
-     * 
-     * @param[in] msg The message to log.
-     * @param[in] data The data to log.
-     * @param[in] data_size The size of the data to log.
-     * @param[in] state The state to log.
-     */
-    void KERNEL_LOG_WARNING(const char* msg, const void* data, 
-                            const size_t data_size, const ERROR_CODE_E state);
-#else 
-    #define KERNEL_LOG_WARNING(a, b, c, d) ({(void)a; (void)b; (void)c; (void)d;})
-#endif
-#if KERNEL_LOG_LEVEL >= ERROR_LOG_LEVEL
-    /** 
-     * @brief Logs an error message to the log buffer.
-     * 
-     * @details Logs an error message to the log buffer. The logger must 
-     * be initialized before calling this function. Otherwise thins function has
-     * no effect.
-     * 
-     * @param[in] msg The message to log.
-     * @param[in] data The data to log.
-     * @param[in] data_size The size of the data to log.
-     * @param[in] state The state to log.
-     */
-    void KERNEL_LOG_ERROR(const char* msg, const void* data, 
-                          const size_t data_size, const ERROR_CODE_E state);
-#else 
-    #define KERNEL_LOG_ERROR(a, b, c, d) ({(void)a; (void)b; (void)c; (void)d;})
+#if CONFIG_LOG_BINARY == 1
+/** 
+ * @brief Logs a message as a binary frame to the log buffer.
+ * 
+ * @details Logs a message as a binary frame to the log buffer. The frame 
+ * holds the synchronization byte, the level and data size, the state, the 
+ * message identifier (its offset in the .log_strings section), a timestamp
+ * in units of 1024 nanoseconds and the data bytes. The data is truncated to 
+ * LOGGER_BINARY_MAX_DATA bytes. The logger must be initialized before calling
+ * this function. Otherwise this function has no effect.
+ * 
+ * @param[in] level The log level of the message.
+ * @param[in] msg The message to log, located in the .log_strings section.
+ * @param[in] data The data to log.
+ * @param[in] data_size The size of the data to log.
+ * @param[in] state The state to log.
+ */
+void logger_log_binary(const uint8_t level, const char* msg, 
+                       const void* data, const size_t data_size, 
+                       const ERROR_CODE_E state);
+
+/** @brief Logs a message at the given level. */
+#define LOGGER_LOG(level, msg, data, size, state) \
+    logger_log_binary(level, KERNEL_LOG_STRING(msg), data, size, state)
+#else
+/** 
+ * @brief Logs a message to the log buffer.
+ * 
+ * @details Logs a message to the log buffer, prefixed by its level. The data
+ * is truncated to LOGGER_TEXT_MAX_DATA bytes. The line is sent to the log 
+ * sink in a single call. The logger must be initialized before calling this
+ * function. Otherwise this function has no effect.
+ * 
+ * @param[in] level The log level of the message.
+ * @param[in] msg The message to log.
+ * @param[in] data The data to log.
+ * @param[in] data_size The size of the data to log.
+ * @param[in] state The state to log.
+ */
+void logger_log_text(const uint8_t level, const char* msg, 
+                     const void* data, const size_t data_size, 
+                     const ERROR_CODE_E state);
+
+/** @brief Logs a message at the given level. */
+#define LOGGER_LOG(level, msg, data, size, state) \
+    logger_log_text(level, msg, data, size, state)
 #endif
 
+/** 
+ * @brief Discards a disabled log, the arguments are neither evaluated nor
+ * kept in the image.
+ */
+#define LOGGER_DISCARD(msg, data, size, state) ({   \
+    if(0)                                           \
+    {                                               \
+        (void)(msg);                                \
+        (void)(data);                               \
+        (void)(size);                               \
+        (void)(state);                              \
+    }                                               \
+})
+
 #endif /* #ifndef __IO_LOGGER_H__ */
 
+/*******************************************************************************
+ * MODULE LOG LEVEL
+ *
+ * This part is evaluated at each inclusion. A source file selects its log 
+ * level by defining LOG_MODULE_LEVEL before including this file, the global
+ * KERNEL_LOG_LEVEL is used otherwise. The disabled levels are removed at 
+ * compile time.
+ ******************************************************************************/
+
+#undef LOGGER_MODULE_LEVEL
+#ifdef LOG_MODULE_LEVEL
+#define LOGGER_MODULE_LEVEL LOG_MODULE_LEVEL
+#else
+#define LOGGER_MODULE_LEVEL KERNEL_LOG_LEVEL
+#endif
+
+#undef KERNEL_LOG_INFO
+#undef KERNEL_LOG_WARNING
+#undef KERNEL_LOG_ERROR
 
+#if LOGGER_MODULE_LEVEL >= INFO_LOG_LEVEL
+/** @brief Logs an information message. */
+#define KERNEL_LOG_INFO(a, b, c, d) LOGGER_LOG(INFO_LOG_LEVEL, a, b, c, d)
+#else
+#define KERNEL_LOG_INFO(a, b, c, d) LOGGER_DISCARD(a, b, c, d)
+#endif
+
+#if LOGGER_MODULE_LEVEL >= WARNING_LOG_LEVEL
+/** @brief Logs a warning message. */
+#define KERNEL_LOG_WARNING(a, b, c, d) LOGGER_LOG(WARNING_LOG_LEVEL, a, b, c, d)
+#else
+#define KERNEL_LOG_WARNING(a, b, c, d) LOGGER_DISCARD(a, b, c, d)
+#endif
 
+#if LOGGER_MODULE_LEVEL >= ERROR_LOG_LEVEL
+/** @brief Logs an error message. */
+#define KERNEL_LOG_ERROR(a, b, c, d) LOGGER_LOG(ERROR_LOG_LEVEL, a, b, c, d)
+#else
+#define KERNEL_LOG_ERROR(a, b, c, d) LOGGER_DISCARD(a, b, c, d)
+#endif
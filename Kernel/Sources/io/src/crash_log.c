@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * @file crash_log.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Retained crash log module.
+ *
+ * @details Retained crash log module. The retained memory is located in the
+ * .noinit section, placed by the linker script outside of the BSS so the
+ * boot code does not clear it. Its content is only trusted when the magic
+ * values are set, a power on leaves random values in it. The log records are
+ * stored as sent to the log output, text lines or binary frames, and are
+ * sent back unchanged.
+ ******************************************************************************/
+
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_IO
+
+#include "error_types.h"
+#include "stdint.h"
+#include "stddef.h"
+#include "config.h"
+#include "cpu_api.h"
+#include "cpu_timer.h"
+#include "logger.h"
+#include "crash_log.h"
+
+#if CONFIG_CRASH_LOG_ENABLED == 1
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Retained log buffer index mask. */
+#define CRASH_LOG_MASK (CONFIG_CRASH_LOG_SIZE - 1)
+
+#if (CONFIG_CRASH_LOG_SIZE & CRASH_LOG_MASK) != 0
+#error "CONFIG_CRASH_LOG_SIZE must be a power of two"
+#endif
+
+/** @brief Retained crash log memory. */
+struct CRASH_LOG
+{
+    /** @brief Set to CRASH_LOG_MAGIC when the log is valid. */
+    uint32_t magic;
+    /** @brief Free running write index in the log buffer. */
+    uint32_t head;
+    /** @brief Panic record of the run. */
+    CRASH_LOG_PANIC_T panic;
+    /** @brief Log buffer. */
+    uint8_t buffer[CONFIG_CRASH_LOG_SIZE];
+};
+
+/** @brief Short hand for struct CRASH_LOG */
+typedef struct CRASH_LOG CRASH_LOG_T;
+
+/** @brief Retained crash log, not cleared at reset. */
+static CRASH_LOG_T crash_log __attribute__((section(".noinit")));
+
+/** @brief Set when the records are copied to the retained log. */
+static uint8_t crash_log_recording = 0;
+
+/** @brief Set when the retained log holds the previous run crash log. */
+static uint8_t crash_log_pending = 0;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Clears the retained crash log.
+ */
+static void crash_log_reset(void)
+{
+    crash_log.panic.magic = 0;
+    crash_log.head        = 0;
+    crash_log.magic       = CRASH_LOG_MAGIC;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E crash_log_init(void)
+{
+    if(crash_log.magic == CRASH_LOG_MAGIC &&
+       crash_log.panic.magic == CRASH_LOG_PANIC_MAGIC)
+    {
+        /* Keep the previous run log until it is sent */
+        crash_log_pending = 1;
+        return NO_ERROR;
+    }
+
+    crash_log_reset();
+    crash_log_recording = 1;
+
+    return NO_ERROR;
+}
+
+void crash_log_write(const IO_VECTOR_T* vector, const size_t count)
+{
+    uint32_t       int_state;
+    uint32_t       head;
+    const uint8_t* data;
+    size_t         length;
+    size_t         i;
+
+    if(crash_log_recording == 0 || vector == NULL)
+    {
+        return;
+    }
+
+    int_state = cpu_enter_critical();
+
+    head = crash_log.head;
+    for(i = 0; i < count; ++i)
+    {
+        data   = vector[i].base;
+        length = vector[i].length;
+
+        /* Only the last bytes of a record larger than the log are kept */
+        if(length > CONFIG_CRASH_LOG_SIZE)
+        {
+            data   += length - CONFIG_CRASH_LOG_SIZE;
+            length  = CONFIG_CRASH_LOG_SIZE;
+        }
+        while(length-- > 0)
+        {
+            crash_log.buffer[head++ & CRASH_LOG_MASK] = *data++;
+        }
+    }
+    crash_log.head = head;
+
+    cpu_exit_critical(int_state);
+}
+
+void crash_log_set_panic(const CRASH_LOG_PANIC_T* record)
+{
+    uint64_t time;
+
+    if(record == NULL)
+    {
+        return;
+    }
+
+    /* The panic may happen before the crash log initialization */
+    if(crash_log.magic != CRASH_LOG_MAGIC)
+    {
+        crash_log_reset();
+    }
+
+    crash_log.panic = *record;
+
+    crash_log.panic.time = 0;
+    if(cpu_timer_get_time_ns(&time) == NO_ERROR)
+    {
+        crash_log.panic.time = (uint32_t)(time >> 10);
+    }
+
+    /* Set last, the record is only valid once complete */
+    crash_log.panic.magic = CRASH_LOG_PANIC_MAGIC;
+}
+
+ERROR_CODE_E crash_log_get_panic(CRASH_LOG_PANIC_T* record)
+{
+    if(record == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(crash_log_pending == 0)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    *record = crash_log.panic;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E crash_log_flush(const LOGGER_SETTINGS_T* settings)
+{
+    IO_VECTOR_T vector[2];
+    uint32_t    head;
+    uint32_t    start;
+
+    if(settings == NULL || settings->logger_buffer_writev == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(crash_log_pending == 0)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    /* Oldest byte first, the log wraps once it was filled */
+    head = crash_log.head;
+    if(head <= CONFIG_CRASH_LOG_SIZE)
+    {
+        vector[0].base   = crash_log.buffer;
+        vector[0].length = head;
+        vector[1].base   = NULL;
+        vector[1].length = 0;
+    }
+    else
+    {
+        start = head & CRASH_LOG_MASK;
+
+        vector[0].base   = &crash_log.buffer[start];
+        vector[0].length = CONFIG_CRASH_LOG_SIZE - start;
+        vector[1].base   = crash_log.buffer;
+        vector[1].length = start;
+    }
+
+    settings->logger_buffer_writev(vector, 2);
+
+    crash_log_pending = 0;
+    crash_log_reset();
+    crash_log_recording = 1;
+
+    return NO_ERROR;
+}
+
+#endif /* #if CONFIG_CRASH_LOG_ENABLED == 1 */
@@ -13,9 +13,13 @@
  * and errors happening in the kernel.
  ******************************************************************************/
 
+#define LOG_MODULE_LEVEL CONFIG_LOG_LEVEL_IO
+
 #include "error_types.h"
 #include "config.h"
+#include "cpu_timer.h"
 #include "logger.h"
+#include "crash_log.h"
 
 /*******************************************************************************
  * Private data
@@ -35,23 +39,33 @@ uint8_t logger_init_state = 0;
  * Private functions
  ******************************************************************************/
 
-static void byte_to_str(char* buff, const char val)
+#if CONFIG_LOG_BINARY == 0
+/**
+ * @brief Formats a byte as two hexadecimal characters.
+ *
+ * @param[out] buff The buffer receiving the characters.
+ * @param[in] val The byte to format.
+ */
+static void byte_to_str(char* buff, const uint8_t val)
 {
-    buff[0] = hex_table[val & 0xF];
-    buff[1] = hex_table[(val >> 8) & 0xF];
+    buff[0] = hex_table[(val >> 4) & 0xF];
+    buff[1] = hex_table[val & 0xF];
 }
 
+/**
+ * @brief Formats a state as eight hexadecimal characters.
+ *
+ * @param[out] buff The buffer receiving the characters.
+ * @param[in] state The state to format.
+ */
 static void state_to_str(char* buff, const ERROR_CODE_E state)
 {
-    uint32_t val  = (uint32_t)(void*)state;
-    uint32_t size;
-    for(size = 0; size < sizeof(ERROR_CODE_E); ++size)
-    {
-        buff[size] = hex_table[(val >> (8 * size)) & 0xF];
-    }
-    for(; size < 4; ++size)
+    uint32_t val = (uint32_t)state;
+    uint32_t i;
+
+    for(i = 0; i < 8; ++i)
     {
-        buff[size] = 0;
+        buff[i] = hex_table[(val >> (28 - 4 * i)) & 0xF];
     }
 }
 
@@ -66,30 +80,7 @@ static size_t strlen(const char* str)
     return size;
 }
 #endif 
-
-static void logger_log(const char* msg, const void* data, 
-                       const size_t data_size, const ERROR_CODE_E state)
-{
-    size_t i;
-    char   buf[4];
-
-    /* Create the error message */
-    logger_settings.logger_buffer_write(msg, strlen(msg));
-    if(data_size > 0)
-    {
-        logger_settings.logger_buffer_write(" | Data: ", 9);
-
-        for(i = 0; i < data_size; ++i)
-        {
-            byte_to_str(buf, *((char*)data++));
-            logger_settings.logger_buffer_write(buf, 2);
-        }
-    }
-    logger_settings.logger_buffer_write(" | 0x", 5);
-    state_to_str(buf, state);
-    logger_settings.logger_buffer_write(buf, strlen(buf));
-    logger_settings.logger_buffer_write("\r\n", 2);
-}
+#endif
 
 /*******************************************************************************
  * Public functions
@@ -109,39 +100,130 @@ ERROR_CODE_E logger_init(const LOGGER_SETTINGS_T* settings)
     return NO_ERROR;
 }
 
-#if KERNEL_LOG_LEVEL >= INFO_LOG_LEVEL
-void KERNEL_LOG_INFO(const char* msg, const void* data, 
-                     const size_t data_size, const ERROR_CODE_E state)
+#if CONFIG_LOG_BINARY == 1
+void logger_log_binary(const uint8_t level, const char* msg, 
+                       const void* data, const size_t data_size, 
+                       const ERROR_CODE_E state)
 {
-    if(logger_init_state != 0)
+    uint8_t     frame[LOGGER_BINARY_HEADER_SIZE];
+    IO_VECTOR_T vector[2];
+    uint64_t    time;
+    uint32_t    stamp;
+    uint32_t    id;
+    size_t      size;
+
+    if(logger_init_state == 0)
     {
-        /* Create the error message */
-        logger_settings.logger_buffer_write("[INFO] ", 7);
-        logger_log(msg, data, data_size, state);
+        return;
     }
-}
-#endif
 
-#if KERNEL_LOG_LEVEL >= WARNING_LOG_LEVEL
-void KERNEL_LOG_WARNING(const char* msg, const void* data, 
-                        const size_t data_size, const ERROR_CODE_E state)
-{
-    if(logger_init_state != 0)
+    size = (data_size > LOGGER_BINARY_MAX_DATA) ? LOGGER_BINARY_MAX_DATA :
+                                                  data_size;
+    if(data == NULL)
     {
-        logger_settings.logger_buffer_write("[WARN] ", 7);
-        logger_log(msg, data, data_size, state);
+        size = 0;
     }
-}
+
+    /* Timestamp in units of 1024 nanoseconds, avoids a division */
+    stamp = 0;
+    if(cpu_timer_get_time_ns(&time) == NO_ERROR)
+    {
+        stamp = (uint32_t)(time >> 10);
+    }
+    id = (uint32_t)(uintptr_t)msg;
+
+    /* Little endian header, the frame is sent in a single call to the sink so 
+     * frames never mix
+     */
+    frame[0] = LOGGER_BINARY_SYNC;
+    frame[1] = (uint8_t)((level << 6) | size);
+    frame[2] = (uint8_t)state;
+    frame[3] = (uint8_t)id;
+    frame[4] = (uint8_t)(id >> 8);
+    frame[5] = (uint8_t)stamp;
+    frame[6] = (uint8_t)(stamp >> 8);
+    frame[7] = (uint8_t)(stamp >> 16);
+    frame[8] = (uint8_t)(stamp >> 24);
+
+    vector[0].base   = frame;
+    vector[0].length = LOGGER_BINARY_HEADER_SIZE;
+    vector[1].base   = data;
+    vector[1].length = size;
+
+#if CONFIG_CRASH_LOG_ENABLED == 1
+    crash_log_write(vector, 2);
 #endif
+    logger_settings.logger_buffer_writev(vector, 2);
+}
+#else
 
-#if KERNEL_LOG_LEVEL >= ERROR_LOG_LEVEL
-void KERNEL_LOG_ERROR(const char* msg, const void* data, 
-                      const size_t data_size, const ERROR_CODE_E state)
+void logger_log_text(const uint8_t level, const char* msg, 
+                     const void* data, const size_t data_size, 
+                     const ERROR_CODE_E state)
 {
-    if(logger_init_state != 0)
+    /* " | Data: " + data + " | 0x" + state + "\r\n" */
+    char        tail[9 + 2 * LOGGER_TEXT_MAX_DATA + 5 + 8 + 2];
+    IO_VECTOR_T vector[3];
+    size_t      size;
+    size_t      pos;
+    size_t      i;
+
+    if(logger_init_state == 0)
+    {
+        return;
+    }
+
+    switch(level)
+    {
+        case INFO_LOG_LEVEL:
+            vector[0].base   = "[INFO] ";
+            vector[0].length = 7;
+            break;
+        case WARNING_LOG_LEVEL:
+            vector[0].base   = "[WARN] ";
+            vector[0].length = 7;
+            break;
+        default:
+            vector[0].base   = "[ERROR] ";
+            vector[0].length = 8;
+            break;
+    }
+    vector[1].base   = msg;
+    vector[1].length = strlen(msg);
+
+    /* Format the data and state in a single buffer */
+    pos = 0;
+    if(data_size > 0 && data != NULL)
+    {
+        size = (data_size > LOGGER_TEXT_MAX_DATA) ? LOGGER_TEXT_MAX_DATA :
+                                                    data_size;
+
+        for(i = 0; i < 9; ++i)
+        {
+            tail[pos++] = " | Data: "[i];
+        }
+        for(i = 0; i < size; ++i)
+        {
+            byte_to_str(&tail[pos], ((const uint8_t*)data)[i]);
+            pos += 2;
+        }
+    }
+    for(i = 0; i < 5; ++i)
     {
-        logger_settings.logger_buffer_write("[ERROR] ", 8);
-        logger_log(msg, data, data_size, state);
+        tail[pos++] = " | 0x"[i];
     }
+    state_to_str(&tail[pos], state);
+    pos += 8;
+    tail[pos++] = '\r';
+    tail[pos++] = '\n';
+
+    vector[2].base   = tail;
+    vector[2].length = pos;
+
+#if CONFIG_CRASH_LOG_ENABLED == 1
+    crash_log_write(vector, 3);
+#endif
+    logger_settings.logger_buffer_writev(vector, 3);
 }
+
 #endif
@@ -1,2 +1,3 @@
 DEP_INCLUDES= -I ../types/includes
+DEP_INCLUDES+= -I ../arch/cpu/includes
 DEP_LIBS=
\ No newline at end of file
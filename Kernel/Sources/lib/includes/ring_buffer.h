@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * @file ring_buffer.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Lock-free ring buffers.
+ *
+ * @details Lock-free ring buffers. The single producer / single consumer ring
+ * buffer streams bytes between one writer and one reader, for instance a task
+ * and an interrupt handler. The multiple producers / single consumer ring 
+ * buffer carries words posted concurrently by several tasks and interrupt 
+ * handlers, the slots are reserved with the CPU atomic operations. None of
+ * the buffers mask the interrupts.
+ ******************************************************************************/
+
+#ifndef __LIB_RING_BUFFER_H__
+#define __LIB_RING_BUFFER_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Single producer / single consumer byte ring buffer. */
+struct SPSC_RING_BUFFER
+{
+    /** @brief Buffer storage, provided by the user. */
+    uint8_t* buffer;
+    /** @brief Buffer size in bytes, a power of two. */
+    uint32_t size;
+
+    /** @brief Free running write index, only updated by the producer. */
+    volatile uint32_t head;
+    /** @brief Free running read index, only updated by the consumer. */
+    volatile uint32_t tail;
+};
+
+/** @brief Short hand for struct SPSC_RING_BUFFER */
+typedef struct SPSC_RING_BUFFER SPSC_RING_BUFFER_T;
+
+/** @brief Multiple producers / single consumer ring buffer slot. */
+struct MPSC_RING_SLOT
+{
+    /** @brief Slot sequence number, tells if the slot is free or filled. */
+    volatile uint32_t sequence;
+    /** @brief Slot value. */
+    uintptr_t value;
+};
+
+/** @brief Short hand for struct MPSC_RING_SLOT */
+typedef struct MPSC_RING_SLOT MPSC_RING_SLOT_T;
+
+/** @brief Multiple producers / single consumer word ring buffer. */
+struct MPSC_RING_BUFFER
+{
+    /** @brief Slots storage, provided by the user. */
+    MPSC_RING_SLOT_T* slots;
+    /** @brief Number of slots, a power of two. */
+    uint32_t count;
+
+    /** @brief Free running reservation index, shared by the producers. */
+    volatile uint32_t head;
+    /** @brief Free running read index, only updated by the consumer. */
+    volatile uint32_t tail;
+};
+
+/** @brief Short hand for struct MPSC_RING_BUFFER */
+typedef struct MPSC_RING_BUFFER MPSC_RING_BUFFER_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Initializes a single producer / single consumer ring buffer.
+ *
+ * @param[out] ring The ring buffer to initialize.
+ * @param[in] buffer The ring buffer storage.
+ * @param[in] size The storage size in bytes, must be a power of two.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E spsc_ring_buffer_init(SPSC_RING_BUFFER_T* ring,
+                                   void* buffer,
+                                   const uint32_t size);
+
+/**
+ * @brief Writes bytes in a single producer / single consumer ring buffer.
+ *
+ * @details Writes bytes in the ring buffer. Only the bytes that fit in the 
+ * free space are written. This function must only be called by the producer.
+ *
+ * @param[in, out] ring The ring buffer to write.
+ * @param[in] data The bytes to write.
+ * @param[in] length The number of bytes to write.
+ *
+ * @return The number of bytes written is returned.
+ */
+uint32_t spsc_ring_buffer_write(SPSC_RING_BUFFER_T* ring,
+                                const void* data,
+                                const uint32_t length);
+
+/**
+ * @brief Reads bytes from a single producer / single consumer ring buffer.
+ *
+ * @details Reads at most length bytes from the ring buffer. This function 
+ * must only be called by the consumer.
+ *
+ * @param[in, out] ring The ring buffer to read.
+ * @param[out] data The buffer receiving the bytes.
+ * @param[in] length The maximal number of bytes to read.
+ *
+ * @return The number of bytes read is returned.
+ */
+uint32_t spsc_ring_buffer_read(SPSC_RING_BUFFER_T* ring,
+                               void* data,
+                               const uint32_t length);
+
+/**
+ * @brief Gets the contiguous readable bytes of a ring buffer.
+ *
+ * @details Gets the address and size of the readable bytes that are 
+ * contiguous in the ring buffer storage, without consuming them. Used to 
+ * hand the data directly to a peripheral. This function must only be called 
+ * by the consumer.
+ *
+ * @param[in] ring The ring buffer to read.
+ * @param[out] data The pointer to store the address of the first byte.
+ *
+ * @return The number of contiguous readable bytes is returned.
+ */
+uint32_t spsc_ring_buffer_peek(const SPSC_RING_BUFFER_T* ring,
+                               const uint8_t** data);
+
+/**
+ * @brief Consumes bytes from a single producer / single consumer ring buffer.
+ *
+ * @details Releases bytes previously obtained with spsc_ring_buffer_peek. 
+ * This function must only be called by the consumer.
+ *
+ * @param[in, out] ring The ring buffer to update.
+ * @param[in] length The number of bytes to release.
+ */
+void spsc_ring_buffer_consume(SPSC_RING_BUFFER_T* ring, const uint32_t length);
+
+/**
+ * @brief Returns the number of readable bytes of a ring buffer.
+ *
+ * @param[in] ring The ring buffer to query.
+ *
+ * @return The number of readable bytes is returned.
+ */
+uint32_t spsc_ring_buffer_get_used(const SPSC_RING_BUFFER_T* ring);
+
+/**
+ * @brief Initializes a multiple producers / single consumer ring buffer.
+ *
+ * @param[out] ring The ring buffer to initialize.
+ * @param[in] slots The ring buffer slots storage.
+ * @param[in] count The number of slots, must be a power of two.
+ *
+ * @return NO_ERROR is returned in case of success. Otherwise an error code is
+ * returned. Please refer to the list of the standard error codes.
+ */
+ERROR_CODE_E mpsc_ring_buffer_init(MPSC_RING_BUFFER_T* ring,
+                                   MPSC_RING_SLOT_T* slots,
+                                   const uint32_t count);
+
+/**
+ * @brief Pushes a value in a multiple producers / single consumer ring 
+ * buffer.
+ *
+ * @details Pushes a value in the ring buffer. This function is lock-free and
+ * can be called concurrently from any task or interrupt handler.
+ *
+ * @param[in, out] ring The ring buffer to update.
+ * @param[in] value The value to push.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_NO_MEMORY is 
+ * returned if the ring buffer is full.
+ */
+ERROR_CODE_E mpsc_ring_buffer_push(MPSC_RING_BUFFER_T* ring,
+                                   const uintptr_t value);
+
+/**
+ * @brief Pops a value from a multiple producers / single consumer ring 
+ * buffer.
+ *
+ * @details Pops the oldest value of the ring buffer. A value whose producer 
+ * was preempted before completing its push is not visible yet. This function
+ * must only be called by the consumer.
+ *
+ * @param[in, out] ring The ring buffer to update.
+ * @param[out] value The pointer to store the value.
+ *
+ * @return NO_ERROR is returned in case of success. ERROR_NOT_AVAILABLE is 
+ * returned if no value is available.
+ */
+ERROR_CODE_E mpsc_ring_buffer_pop(MPSC_RING_BUFFER_T* ring,
+                                  uintptr_t* value);
+
+#endif /* #ifndef __LIB_RING_BUFFER_H__ */
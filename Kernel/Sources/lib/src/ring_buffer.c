@@ -0,0 +1,274 @@
+/*******************************************************************************
+ * @file ring_buffer.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Lock-free ring buffers.
+ *
+ * @details Lock-free ring buffers. The indexes are free running and masked 
+ * with the power of two size on access. In the single producer / single 
+ * consumer buffer, each index is only written by one side and published 
+ * after the data. In the multiple producers / single consumer buffer, the 
+ * producers reserve a slot with a compare and swap on the head index and 
+ * publish it through the slot sequence number.
+ ******************************************************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "error_types.h"
+#include "cpu_api.h"
+#include "cpu_atomic.h"
+#include "ring_buffer.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Copies bytes.
+ *
+ * @param[out] dst The destination buffer.
+ * @param[in] src The source buffer.
+ * @param[in] length The number of bytes to copy.
+ */
+static void ring_buffer_copy(uint8_t* dst, 
+                             const uint8_t* src, 
+                             const uint32_t length)
+{
+    uint32_t i;
+
+    for(i = 0; i < length; ++i)
+    {
+        dst[i] = src[i];
+    }
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+ERROR_CODE_E spsc_ring_buffer_init(SPSC_RING_BUFFER_T* ring,
+                                   void* buffer,
+                                   const uint32_t size)
+{
+    if(ring == NULL || buffer == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(size == 0 || (size & (size - 1)) != 0)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+
+    ring->buffer = buffer;
+    ring->size   = size;
+    ring->head   = 0;
+    ring->tail   = 0;
+
+    return NO_ERROR;
+}
+
+uint32_t spsc_ring_buffer_write(SPSC_RING_BUFFER_T* ring,
+                                const void* data,
+                                const uint32_t length)
+{
+    uint32_t head;
+    uint32_t index;
+    uint32_t count;
+    uint32_t first;
+
+    head  = ring->head;
+    count = ring->size - (head - ring->tail);
+    if(length < count)
+    {
+        count = length;
+    }
+    if(count == 0)
+    {
+        return 0;
+    }
+
+    /* Copy up to the end of the storage, then wrap */
+    index = head & (ring->size - 1);
+    first = ring->size - index;
+    if(count < first)
+    {
+        first = count;
+    }
+    ring_buffer_copy(ring->buffer + index, data, first);
+    ring_buffer_copy(ring->buffer, (const uint8_t*)data + first, count - first);
+
+    /* Publish the data */
+    cpu_mem_barrier();
+    ring->head = head + count;
+
+    return count;
+}
+
+uint32_t spsc_ring_buffer_read(SPSC_RING_BUFFER_T* ring,
+                               void* data,
+                               const uint32_t length)
+{
+    uint32_t tail;
+    uint32_t index;
+    uint32_t count;
+    uint32_t first;
+
+    tail  = ring->tail;
+    count = ring->head - tail;
+    if(length < count)
+    {
+        count = length;
+    }
+    if(count == 0)
+    {
+        return 0;
+    }
+    cpu_mem_barrier();
+
+    /* Copy up to the end of the storage, then wrap */
+    index = tail & (ring->size - 1);
+    first = ring->size - index;
+    if(count < first)
+    {
+        first = count;
+    }
+    ring_buffer_copy(data, ring->buffer + index, first);
+    ring_buffer_copy((uint8_t*)data + first, ring->buffer, count - first);
+
+    /* Release the space */
+    cpu_mem_barrier();
+    ring->tail = tail + count;
+
+    return count;
+}
+
+uint32_t spsc_ring_buffer_peek(const SPSC_RING_BUFFER_T* ring,
+                               const uint8_t** data)
+{
+    uint32_t tail;
+    uint32_t index;
+    uint32_t count;
+
+    tail  = ring->tail;
+    count = ring->head - tail;
+    index = tail & (ring->size - 1);
+    if(count > ring->size - index)
+    {
+        count = ring->size - index;
+    }
+
+    *data = ring->buffer + index;
+
+    return count;
+}
+
+void spsc_ring_buffer_consume(SPSC_RING_BUFFER_T* ring, const uint32_t length)
+{
+    cpu_mem_barrier();
+    ring->tail = ring->tail + length;
+}
+
+uint32_t spsc_ring_buffer_get_used(const SPSC_RING_BUFFER_T* ring)
+{
+    return ring->head - ring->tail;
+}
+
+ERROR_CODE_E mpsc_ring_buffer_init(MPSC_RING_BUFFER_T* ring,
+                                   MPSC_RING_SLOT_T* slots,
+                                   const uint32_t count)
+{
+    uint32_t i;
+
+    if(ring == NULL || slots == NULL)
+    {
+        return ERROR_NULL_POINTER;
+    }
+    if(count == 0 || (count & (count - 1)) != 0)
+    {
+        return ERROR_INVALID_PARAM;
+    }
+
+    /* A slot is free when its sequence equals the head index */
+    for(i = 0; i < count; ++i)
+    {
+        slots[i].sequence = i;
+        slots[i].value    = 0;
+    }
+
+    ring->slots = slots;
+    ring->count = count;
+    ring->head  = 0;
+    ring->tail  = 0;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E mpsc_ring_buffer_push(MPSC_RING_BUFFER_T* ring,
+                                   const uintptr_t value)
+{
+    MPSC_RING_SLOT_T* slot;
+    uint32_t          head;
+    int32_t           diff;
+
+    /* Reserve a slot */
+    while(1)
+    {
+        head = ring->head;
+        slot = &ring->slots[head & (ring->count - 1)];
+        diff = (int32_t)(slot->sequence - head);
+
+        if(diff == 0)
+        {
+            if(cpu_atomic_cas(&ring->head, head, head + 1) == head)
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {
+            /* The slot was not consumed yet */
+            return ERROR_NO_MEMORY;
+        }
+        /* Otherwise another producer reserved the slot, retry */
+    }
+
+    /* Fill and publish the slot */
+    slot->value = value;
+    cpu_mem_barrier();
+    slot->sequence = head + 1;
+
+    return NO_ERROR;
+}
+
+ERROR_CODE_E mpsc_ring_buffer_pop(MPSC_RING_BUFFER_T* ring,
+                                  uintptr_t* value)
+{
+    MPSC_RING_SLOT_T* slot;
+    uint32_t          tail;
+
+    tail = ring->tail;
+    slot = &ring->slots[tail & (ring->count - 1)];
+    if(slot->sequence != tail + 1)
+    {
+        return ERROR_NOT_AVAILABLE;
+    }
+    cpu_mem_barrier();
+
+    *value = slot->value;
+
+    /* Free the slot for the next lap */
+    cpu_mem_barrier();
+    slot->sequence = tail + ring->count;
+    ring->tail     = tail + 1;
+
+    return NO_ERROR;
+}
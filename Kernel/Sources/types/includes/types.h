@@ -1,34 +1,46 @@
-/*******************************************************************************
- * @file types.h
- *
- * @author Alexy Torres Aurora Dugo
- *
- * @date 24/06/2020
- *
- * @version 1.0
- *
- * @brief Kernel generic types definitions.
- *
- * @details Kernel generic types definitions. This modules defines the 
- * structures enumerations and macros used in the kernel.
- ******************************************************************************/
-
-#ifndef __TYPES_TYPES_H__
-#define __TYPES_TYPES_H__
-
-#include "stddef.h"
-#include "stdint.h"
-
-/*******************************************************************************
- * DEFINES
- ******************************************************************************/
-
-/*******************************************************************************
- * STRUCTURES
- ******************************************************************************/
-
-/*******************************************************************************
- * FUNCTIONS
- ******************************************************************************/
-
+/*******************************************************************************
+ * @file types.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 24/06/2020
+ *
+ * @version 1.0
+ *
+ * @brief Kernel generic types definitions.
+ *
+ * @details Kernel generic types definitions. This modules defines the 
+ * structures enumerations and macros used in the kernel.
+ ******************************************************************************/
+
+#ifndef __TYPES_TYPES_H__
+#define __TYPES_TYPES_H__
+
+#include "stddef.h"
+#include "stdint.h"
+
+/*******************************************************************************
+ * DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ * STRUCTURES
+ ******************************************************************************/
+
+/** @brief Buffer descriptor used by the gathered (vectored) writes. */
+struct IO_VECTOR
+{
+    /** @brief Buffer start address. */
+    const void* base;
+    /** @brief Buffer size in bytes. */
+    size_t length;
+};
+
+/** @brief Short hand for struct IO_VECTOR */
+typedef struct IO_VECTOR IO_VECTOR_T;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
 #endif /* #ifndef __TYPES_TYPES_H__ */
\ No newline at end of file
@@ -1,3 +1,3 @@
-DEP_INCLUDES=
-
+DEP_INCLUDES=
+
 DEP_LIBS=
\ No newline at end of file
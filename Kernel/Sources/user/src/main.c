@@ -1,4 +1,4 @@
-int user_main(void)
-{
-    return 0;
+int user_main(void)
+{
+    return 0;
 }
\ No newline at end of file
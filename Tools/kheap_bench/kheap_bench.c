@@ -0,0 +1,436 @@
+/*******************************************************************************
+ * @file kheap_bench.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Host kernel heap stress benchmark.
+ *
+ * @details Host kernel heap stress benchmark. The kernel TLSF heap (kheap.c,
+ * built unchanged) and a naive first-fit allocator run the same random
+ * allocation and release sequence on a heap region of the same size. The
+ * latency distribution of each operation, the failures and the content of
+ * the blocks are checked and reported for both allocators.
+ *
+ * Usage: make && ./kheap_bench [operations] [seed]
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "error_types.h"
+#include "cpu_api.h"
+#include "logger.h"
+#include "kheap.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Default number of operations. */
+#define BENCH_DEFAULT_OPS 200000
+
+/** @brief Maximal number of live allocations. */
+#define BENCH_MAX_LIVE 256
+
+/** @brief First-fit block header size, keeps the payload 8 bytes aligned. */
+#define FF_HEADER_SIZE 8
+
+/** @brief First-fit block size flag: the block is used. */
+#define FF_USED 0x1
+
+/** @brief Heap region, used by kheap through the linker defined symbols. */
+uint8_t bench_heap[BENCH_HEAP_SIZE] __attribute__((aligned(8)));
+
+/** @brief First-fit heap region. */
+static uint8_t ff_heap[BENCH_HEAP_SIZE] __attribute__((aligned(8)));
+
+/** @brief Operation applied to both allocators. */
+struct BENCH_OP
+{
+    /** @brief Live slot the operation applies to. */
+    uint32_t slot;
+    /** @brief Allocation size, 0 for a release. */
+    uint32_t size;
+};
+
+/** @brief Short hand for struct BENCH_OP */
+typedef struct BENCH_OP BENCH_OP_T;
+
+/** @brief Allocator under test. */
+struct BENCH_ALLOCATOR
+{
+    /** @brief Allocator name. */
+    const char* name;
+    /** @brief Allocation routine. */
+    void* (*alloc)(const size_t size);
+    /** @brief Release routine. */
+    void (*release)(void* ptr);
+};
+
+/** @brief Short hand for struct BENCH_ALLOCATOR */
+typedef struct BENCH_ALLOCATOR BENCH_ALLOCATOR_T;
+
+/** @brief xorshift32 random generator state. */
+static uint32_t bench_seed;
+
+/*******************************************************************************
+ * Kernel stubs
+ ******************************************************************************/
+
+uint32_t cpu_enter_critical(void)
+{
+    return 0;
+}
+
+void cpu_exit_critical(const uint32_t state)
+{
+    (void)state;
+}
+
+void logger_log_text(const uint8_t level, const char* msg,
+                     const void* data, const size_t data_size,
+                     const ERROR_CODE_E state)
+{
+    (void)level;
+    (void)msg;
+    (void)data;
+    (void)data_size;
+    (void)state;
+}
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+static uint32_t bench_random(void)
+{
+    bench_seed ^= bench_seed << 13;
+    bench_seed ^= bench_seed >> 17;
+    bench_seed ^= bench_seed << 5;
+    return bench_seed;
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Initializes the first-fit heap with a single free block.
+ */
+static void ff_init(void)
+{
+    *(size_t*)ff_heap = BENCH_HEAP_SIZE;
+}
+
+/**
+ * @brief Naive first-fit allocation.
+ *
+ * @details Walks the implicit block list from the start of the heap, merges
+ * the consecutive free blocks on the way and takes the first one large
+ * enough, split if the remainder can hold a block.
+ */
+static void* ff_alloc(const size_t size)
+{
+    uint8_t* block;
+    uint8_t* next;
+    size_t   need;
+    size_t   block_size;
+
+    need  = (size + FF_HEADER_SIZE + 7) & ~(size_t)7;
+    block = ff_heap;
+    while(block < ff_heap + BENCH_HEAP_SIZE)
+    {
+        block_size = *(size_t*)block;
+        if((block_size & FF_USED) == 0)
+        {
+            /* Merge the following free blocks */
+            next = block + block_size;
+            while(next < ff_heap + BENCH_HEAP_SIZE &&
+                  (*(size_t*)next & FF_USED) == 0)
+            {
+                block_size += *(size_t*)next;
+                next       += *(size_t*)next;
+            }
+            *(size_t*)block = block_size;
+
+            if(block_size >= need)
+            {
+                if(block_size - need >= FF_HEADER_SIZE + 8)
+                {
+                    *(size_t*)(block + need) = block_size - need;
+                    block_size = need;
+                }
+                *(size_t*)block = block_size | FF_USED;
+                return block + FF_HEADER_SIZE;
+            }
+        }
+        block += block_size & ~(size_t)FF_USED;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Naive first-fit release, the block is merged by later allocations.
+ */
+static void ff_free(void* ptr)
+{
+    *(size_t*)((uint8_t*)ptr - FF_HEADER_SIZE) &= ~(size_t)FF_USED;
+}
+
+static void* tlsf_alloc(const size_t size)
+{
+    return kmalloc(size);
+}
+
+static void tlsf_free(void* ptr)
+{
+    (void)kfree(ptr);
+}
+
+static int bench_compare(const void* a, const void* b)
+{
+    uint32_t va = *(const uint32_t*)a;
+    uint32_t vb = *(const uint32_t*)b;
+
+    return (va > vb) - (va < vb);
+}
+
+/**
+ * @brief Prints the latency distribution of an operation.
+ */
+static void bench_report(const char* name, uint32_t* samples,
+                         const uint32_t count)
+{
+    if(count == 0)
+    {
+        return;
+    }
+
+    qsort(samples, count, sizeof(uint32_t), bench_compare);
+    printf("  %-6s n=%-7u p50=%5u p90=%5u p99=%5u p99.9=%6u max=%7u ns\n",
+           name, count,
+           samples[count / 2],
+           samples[(uint64_t)count * 90 / 100],
+           samples[(uint64_t)count * 99 / 100],
+           samples[(uint64_t)count * 999 / 1000],
+           samples[count - 1]);
+}
+
+/**
+ * @brief Generates the operation sequence shared by the allocators.
+ *
+ * @details The sizes are mostly small, with a tail of large blocks: 70% in
+ * 8-64 bytes, 25% in 64-512 bytes and 5% in 512-2048 bytes.
+ */
+static void bench_generate(BENCH_OP_T* ops, const uint32_t count)
+{
+    uint8_t  live[BENCH_MAX_LIVE];
+    uint32_t live_count;
+    uint32_t class;
+    uint32_t slot;
+    uint32_t i;
+
+    memset(live, 0, sizeof(live));
+    live_count = 0;
+    for(i = 0; i < count; ++i)
+    {
+        slot = bench_random() % BENCH_MAX_LIVE;
+        if(live[slot] != 0 &&
+           (live_count == BENCH_MAX_LIVE || (bench_random() & 1) != 0))
+        {
+            ops[i].slot = slot;
+            ops[i].size = 0;
+            live[slot]  = 0;
+            --live_count;
+            continue;
+        }
+        while(live[slot] != 0)
+        {
+            slot = (slot + 1) % BENCH_MAX_LIVE;
+        }
+
+        class = bench_random() % 100;
+        if(class < 70)
+        {
+            ops[i].size = 8 + bench_random() % 57;
+        }
+        else if(class < 95)
+        {
+            ops[i].size = 64 + bench_random() % 449;
+        }
+        else
+        {
+            ops[i].size = 512 + bench_random() % 1537;
+        }
+        ops[i].slot = slot;
+        live[slot]  = 1;
+        ++live_count;
+    }
+}
+
+/**
+ * @brief Runs the operation sequence on an allocator and reports it.
+ *
+ * @return The number of corrupted blocks is returned.
+ */
+static uint32_t bench_run(const BENCH_ALLOCATOR_T* allocator,
+                          const BENCH_OP_T* ops, const uint32_t count,
+                          uint32_t* alloc_samples, uint32_t* free_samples)
+{
+    uint8_t* ptrs[BENCH_MAX_LIVE];
+    uint32_t sizes[BENCH_MAX_LIVE];
+    uint32_t alloc_count;
+    uint32_t free_count;
+    uint32_t failures;
+    uint32_t corrupted;
+    uint64_t start;
+    uint32_t slot;
+    uint32_t i;
+    uint32_t j;
+
+    memset(ptrs, 0, sizeof(ptrs));
+    alloc_count = 0;
+    free_count  = 0;
+    failures    = 0;
+    corrupted   = 0;
+
+    for(i = 0; i < count; ++i)
+    {
+        slot = ops[i].slot;
+        if(ops[i].size == 0)
+        {
+            if(ptrs[slot] == NULL)
+            {
+                continue;
+            }
+            for(j = 0; j < sizes[slot]; ++j)
+            {
+                if(ptrs[slot][j] != (uint8_t)(slot + j))
+                {
+                    ++corrupted;
+                    break;
+                }
+            }
+
+            start = bench_now_ns();
+            allocator->release(ptrs[slot]);
+            free_samples[free_count++] = (uint32_t)(bench_now_ns() - start);
+            ptrs[slot] = NULL;
+        }
+        else
+        {
+            start      = bench_now_ns();
+            ptrs[slot] = allocator->alloc(ops[i].size);
+            alloc_samples[alloc_count++] =
+                (uint32_t)(bench_now_ns() - start);
+            if(ptrs[slot] == NULL)
+            {
+                ++failures;
+                continue;
+            }
+            sizes[slot] = ops[i].size;
+            for(j = 0; j < sizes[slot]; ++j)
+            {
+                ptrs[slot][j] = (uint8_t)(slot + j);
+            }
+        }
+    }
+
+    printf("%s: %u failed allocations, %u corrupted blocks\n",
+           allocator->name, failures, corrupted);
+    bench_report("malloc", alloc_samples, alloc_count);
+    bench_report("free", free_samples, free_count);
+
+    /* Release the remaining blocks */
+    for(slot = 0; slot < BENCH_MAX_LIVE; ++slot)
+    {
+        if(ptrs[slot] != NULL)
+        {
+            allocator->release(ptrs[slot]);
+        }
+    }
+
+    return corrupted;
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    const BENCH_ALLOCATOR_T allocators[2] = {
+        {"TLSF kheap", tlsf_alloc, tlsf_free},
+        {"First-fit", ff_alloc, ff_free}
+    };
+
+    BENCH_OP_T*   ops;
+    uint32_t*     alloc_samples;
+    uint32_t*     free_samples;
+    uint32_t      count;
+    uint32_t      corrupted;
+    KHEAP_STATS_T stats;
+
+    count      = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) :
+                              BENCH_DEFAULT_OPS;
+    bench_seed = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) :
+                              0x4C55546B;
+    if(count == 0 || bench_seed == 0)
+    {
+        fprintf(stderr, "Usage: %s [operations] [seed]\n", argv[0]);
+        return 1;
+    }
+
+    ops           = malloc(sizeof(BENCH_OP_T) * count);
+    alloc_samples = malloc(sizeof(uint32_t) * count);
+    free_samples  = malloc(sizeof(uint32_t) * count);
+    if(ops == NULL || alloc_samples == NULL || free_samples == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    if(kheap_init() != NO_ERROR)
+    {
+        fprintf(stderr, "Kernel heap initialization failed\n");
+        return 1;
+    }
+    ff_init();
+
+    bench_generate(ops, count);
+    printf("%u operations, %u bytes heap, at most %u live blocks\n\n",
+           count, BENCH_HEAP_SIZE, BENCH_MAX_LIVE);
+
+    corrupted  = bench_run(&allocators[0], ops, count,
+                           alloc_samples, free_samples);
+    corrupted += bench_run(&allocators[1], ops, count,
+                           alloc_samples, free_samples);
+
+    /* All the blocks are released, the kernel heap must be coalesced */
+    (void)kheap_get_stats(&stats);
+    printf("\nTLSF kheap after release: free %zu / %zu bytes, largest block "
+           "%zu bytes, low-water %zu bytes\n",
+           stats.free_size, stats.total_size, stats.largest_free_block,
+           stats.min_free_size);
+
+    free(ops);
+    free(alloc_samples);
+    free(free_samples);
+
+    return (corrupted != 0 || stats.largest_free_block != stats.free_size);
+}
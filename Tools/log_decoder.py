@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+################################################################################
+# LUTk binary log decoder
+#
+# Created: 17/10/2026
+#
+# Author: Alexy Torres Aurora Dugo
+#
+# Decodes the binary log frames sent by the kernel when CONFIG_LOG_BINARY is
+# set. The messages are read from the .log_strings section of the kernel ELF
+# file, the data words pointing to strings in the ELF file are resolved.
+#
+# Usage: log_decoder.py lutk.elf [capture_file]
+#        The frames are read from the capture file, or from the standard input
+#        (for instance: cat /dev/ttyACM0 | log_decoder.py lutk.elf).
+################################################################################
+
+import struct
+import sys
+
+# Frame layout, must match logger.h
+FRAME_SYNC        = 0xA5
+FRAME_HEADER_SIZE = 9
+
+# Timestamp unit in seconds (1024 ns)
+STAMP_UNIT = 1024e-9
+
+LEVELS = {1: "ERROR", 2: "WARN", 3: "INFO"}
+
+
+class ElfStrings:
+    """ Reads the log messages and the read only strings of an ELF32 file. """
+
+    def __init__(self, path):
+        with open(path, "rb") as elf_file:
+            self.image = elf_file.read()
+
+        if self.image[:4] != b"\x7fELF" or self.image[4] != 1:
+            raise ValueError("%s is not an ELF32 file" % path)
+
+        (shoff,) = struct.unpack_from("<I", self.image, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.image, 
+                                                         0x2E)
+
+        sections = []
+        for i in range(shnum):
+            sections.append(struct.unpack_from("<IIIIIIIIII", self.image,
+                                               shoff + i * shentsize))
+
+        names_offset = sections[shstrndx][4]
+
+        self.log_strings = b""
+        self.alloc = []
+        for section in sections:
+            name   = self._cstring(names_offset + section[0])
+            data   = self.image[section[4]:section[4] + section[5]]
+            if name == ".log_strings":
+                self.log_strings = data
+            elif name in (".rodata", ".startup", ".text", ".data"):
+                self.alloc.append((section[3], data))
+
+    def _cstring(self, offset):
+        end = self.image.index(b"\0", offset)
+        return self.image[offset:end].decode("ascii", "replace")
+
+    def message(self, identifier):
+        """ Returns the log message at the given .log_strings offset. """
+        if identifier >= len(self.log_strings):
+            return "<unknown message 0x%04X>" % identifier
+        end = self.log_strings.find(b"\0", identifier)
+        return self.log_strings[identifier:end].decode("ascii", "replace")
+
+    def string_at(self, address):
+        """ Returns the printable string at a target address, or None. """
+        for base, data in self.alloc:
+            if base <= address < base + len(data):
+                offset = address - base
+                end    = data.find(b"\0", offset)
+                if end <= offset or end - offset > 64:
+                    return None
+                text = data[offset:end]
+                if all(32 <= c < 127 for c in text):
+                    return text.decode("ascii")
+        return None
+
+
+def decode(strings, stream, output):
+    buffer     = b""
+    last_stamp = 0
+    wraps      = 0
+
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            break
+        buffer += chunk
+
+        while len(buffer) >= FRAME_HEADER_SIZE:
+            # Resynchronize on the frame synchronization byte
+            if buffer[0] != FRAME_SYNC:
+                buffer = buffer[1:]
+                continue
+
+            level = buffer[1] >> 6
+            size  = buffer[1] & 0x3F
+            if len(buffer) < FRAME_HEADER_SIZE + size:
+                break
+
+            state, identifier, stamp = struct.unpack_from("<BHI", buffer, 2)
+            data   = buffer[FRAME_HEADER_SIZE:FRAME_HEADER_SIZE + size]
+            buffer = buffer[FRAME_HEADER_SIZE + size:]
+
+            # The timestamp wraps every 73 minutes
+            if stamp < last_stamp:
+                wraps += 1
+            last_stamp = stamp
+            seconds = ((wraps << 32) + stamp) * STAMP_UNIT
+
+            line = "[%12.6f] [%s] %s" % (seconds, 
+                                         LEVELS.get(level, "?"),
+                                         strings.message(identifier))
+            if size > 0:
+                line += " | Data: " + data.hex().upper()
+                names = []
+                for offset in range(0, size - 3, 4):
+                    (word,) = struct.unpack_from("<I", data, offset)
+                    text = strings.string_at(word)
+                    if text is not None:
+                        names.append(text)
+                if names:
+                    line += " (" + ", ".join(names) + ")"
+            line += " | 0x%X" % state
+
+            output.write(line + "\n")
+            output.flush()
+
+
+def main():
+    if len(sys.argv) < 2 or len(sys.argv) > 3:
+        sys.stderr.write("Usage: %s lutk.elf [capture_file]\n" % sys.argv[0])
+        return 1
+
+    strings = ElfStrings(sys.argv[1])
+
+    if len(sys.argv) == 3:
+        with open(sys.argv[2], "rb") as stream:
+            decode(strings, stream, sys.stdout)
+    else:
+        decode(strings, sys.stdin.buffer, sys.stdout)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
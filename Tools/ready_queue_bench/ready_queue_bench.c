@@ -0,0 +1,385 @@
+/*******************************************************************************
+ * @file ready_queue_bench.c
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 17/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Host kernel ready queue benchmark.
+ *
+ * @details Host kernel ready queue benchmark. The kernel ready queue
+ * (ready_queue.c, built unchanged) and a priority sorted linked list run the
+ * same election sequence with 2, 16, 64 and 256 tasks. Each election queues
+ * the previous task back with a random priority, as a wakeup of any priority
+ * would, then picks the highest priority task. The latency distribution of
+ * the push and pop operations, minus the clock overhead, and the mean 
+ * election time are reported. The picked priorities of both queues are 
+ * checked against each other.
+ *
+ * Usage: make && ./ready_queue_bench [elections] [seed]
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "error_types.h"
+#include "scheduler.h"
+#include "ready_queue.h"
+
+/*******************************************************************************
+ * Private data
+ ******************************************************************************/
+
+/** @brief Default number of elections for each task count. */
+#define BENCH_DEFAULT_ELECTIONS 200000
+
+/** @brief Maximal number of tasks. */
+#define BENCH_MAX_TASKS 256
+
+/** @brief Number of task counts benchmarked. */
+#define BENCH_SET_COUNT 4
+
+/** @brief Number of rounds timed as a whole, the fastest gives the mean. */
+#define BENCH_ROUNDS 5
+
+/** @brief Number of samples used to calibrate the clock overhead. */
+#define BENCH_CALIBRATION_SAMPLES 100000
+
+/** @brief Queue under test. */
+struct BENCH_QUEUE
+{
+    /** @brief Queue name. */
+    const char* name;
+    /** @brief Initialization routine. */
+    void (*init)(void);
+    /** @brief Push routine. */
+    void (*push)(KERNEL_TASK_T* task);
+    /** @brief Pop routine. */
+    KERNEL_TASK_T* (*pop)(void);
+};
+
+/** @brief Short hand for struct BENCH_QUEUE */
+typedef struct BENCH_QUEUE BENCH_QUEUE_T;
+
+/** @brief Benchmarked tasks. */
+static KERNEL_TASK_T bench_tasks[BENCH_MAX_TASKS];
+
+/** @brief Kernel ready queue under test. */
+static READY_QUEUE_T bench_ready_queue;
+
+/** @brief Head of the priority sorted list under test. */
+static KERNEL_TASK_T* bench_list_head;
+
+/** @brief Median clock overhead in nanoseconds. */
+static uint32_t bench_overhead;
+
+/** @brief xorshift32 random generator state. */
+static uint32_t bench_seed;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+static uint32_t bench_random(void)
+{
+    bench_seed ^= bench_seed << 13;
+    bench_seed ^= bench_seed >> 17;
+    bench_seed ^= bench_seed << 5;
+    return bench_seed;
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int bench_compare(const void* a, const void* b)
+{
+    uint32_t va = *(const uint32_t*)a;
+    uint32_t vb = *(const uint32_t*)b;
+
+    return (va > vb) - (va < vb);
+}
+
+/**
+ * @brief Measures the median duration of an empty timed interval.
+ */
+static void bench_calibrate(uint32_t* samples)
+{
+    uint64_t start;
+    uint32_t i;
+
+    for(i = 0; i < BENCH_CALIBRATION_SAMPLES; ++i)
+    {
+        start      = bench_now_ns();
+        samples[i] = (uint32_t)(bench_now_ns() - start);
+    }
+
+    qsort(samples, BENCH_CALIBRATION_SAMPLES, sizeof(uint32_t), 
+          bench_compare);
+    bench_overhead = samples[BENCH_CALIBRATION_SAMPLES / 2];
+}
+
+/**
+ * @brief Returns the duration of a timed interval minus the clock overhead.
+ */
+static uint32_t bench_elapsed(const uint64_t start)
+{
+    uint32_t elapsed;
+
+    elapsed = (uint32_t)(bench_now_ns() - start);
+
+    return (elapsed > bench_overhead) ? elapsed - bench_overhead : 0;
+}
+
+static void rq_init(void)
+{
+    (void)ready_queue_init(&bench_ready_queue);
+}
+
+static void rq_push(KERNEL_TASK_T* task)
+{
+    ready_queue_push(&bench_ready_queue, task);
+}
+
+static KERNEL_TASK_T* rq_pop(void)
+{
+    return ready_queue_pop(&bench_ready_queue);
+}
+
+static void list_init(void)
+{
+    bench_list_head = NULL;
+}
+
+/**
+ * @brief Priority sorted list insertion.
+ *
+ * @details Walks the list from the head and inserts the task after the tasks
+ * of higher or equal priority.
+ */
+static void list_push(KERNEL_TASK_T* task)
+{
+    KERNEL_TASK_T** cursor;
+
+    cursor = &bench_list_head;
+    while(*cursor != NULL && (*cursor)->priority <= task->priority)
+    {
+        cursor = &(*cursor)->next;
+    }
+
+    task->state = TASK_STATE_READY;
+    task->next  = *cursor;
+    *cursor     = task;
+}
+
+static KERNEL_TASK_T* list_pop(void)
+{
+    KERNEL_TASK_T* task;
+
+    task = bench_list_head;
+    if(task != NULL)
+    {
+        bench_list_head = task->next;
+        task->next      = NULL;
+    }
+
+    return task;
+}
+
+/**
+ * @brief Prints the latency distribution of an operation.
+ */
+static void bench_report(const char* name, uint32_t* samples,
+                         const uint32_t count)
+{
+    qsort(samples, count, sizeof(uint32_t), bench_compare);
+    printf("    %-4s p50=%5u p90=%5u p99=%5u p99.9=%6u max=%7u ns\n",
+           name,
+           samples[count / 2],
+           samples[(uint64_t)count * 90 / 100],
+           samples[(uint64_t)count * 99 / 100],
+           samples[(uint64_t)count * 999 / 1000],
+           samples[count - 1]);
+}
+
+/**
+ * @brief Loads the tasks in a queue, the first task is left running.
+ *
+ * @return The running task is returned.
+ */
+static KERNEL_TASK_T* bench_load(const BENCH_QUEUE_T* queue,
+                                 const uint8_t* priorities,
+                                 const uint32_t task_count)
+{
+    uint32_t i;
+
+    memset(bench_tasks, 0, sizeof(bench_tasks));
+    queue->init();
+    for(i = 0; i < task_count; ++i)
+    {
+        bench_tasks[i].priority = priorities[i];
+        if(i != 0)
+        {
+            queue->push(&bench_tasks[i]);
+        }
+    }
+
+    bench_tasks[0].state = TASK_STATE_RUNNING;
+
+    return &bench_tasks[0];
+}
+
+/**
+ * @brief Runs the election sequence on a queue and reports it.
+ *
+ * @details The sequence is first run timing each push and pop. It is then 
+ * run BENCH_ROUNDS times timing the whole sequence, the fastest round gives
+ * the mean election time without the clock overhead.
+ */
+static void bench_run(const BENCH_QUEUE_T* queue,
+                      const uint8_t* priorities,
+                      const uint32_t task_count,
+                      const uint32_t count,
+                      uint8_t* picked,
+                      uint32_t* push_samples,
+                      uint32_t* pop_samples)
+{
+    KERNEL_TASK_T* running;
+    uint64_t       start;
+    uint64_t       total;
+    uint64_t       best;
+    uint32_t       round;
+    uint32_t       i;
+
+    running = bench_load(queue, priorities, task_count);
+    for(i = 0; i < count; ++i)
+    {
+        running->priority = priorities[task_count + i];
+
+        start = bench_now_ns();
+        queue->push(running);
+        push_samples[i] = bench_elapsed(start);
+
+        start = bench_now_ns();
+        running = queue->pop();
+        pop_samples[i] = bench_elapsed(start);
+
+        picked[i] = running->priority;
+    }
+
+    best = UINT64_MAX;
+    for(round = 0; round < BENCH_ROUNDS; ++round)
+    {
+        running = bench_load(queue, priorities, task_count);
+        start   = bench_now_ns();
+        for(i = 0; i < count; ++i)
+        {
+            running->priority = priorities[task_count + i];
+            queue->push(running);
+            running = queue->pop();
+        }
+        total = bench_now_ns() - start;
+        if(total < best)
+        {
+            best = total;
+        }
+    }
+
+    printf("  %-12s election mean=%6.1f ns\n",
+           queue->name, (double)best / count);
+    bench_report("push", push_samples, count);
+    bench_report("pop", pop_samples, count);
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    const BENCH_QUEUE_T queues[2] = {
+        {"Ready queue", rq_init, rq_push, rq_pop},
+        {"Sorted list", list_init, list_push, list_pop}
+    };
+    const uint32_t task_counts[BENCH_SET_COUNT] = {2, 16, 64, 256};
+
+    uint8_t*  priorities;
+    uint8_t*  picked[2];
+    uint32_t* push_samples;
+    uint32_t* pop_samples;
+    uint32_t  count;
+    uint32_t  mismatch;
+    uint32_t  set;
+    uint32_t  i;
+
+    count      = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) :
+                              BENCH_DEFAULT_ELECTIONS;
+    bench_seed = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) :
+                              0x4C55546B;
+    if(count == 0 || bench_seed == 0)
+    {
+        fprintf(stderr, "Usage: %s [elections] [seed]\n", argv[0]);
+        return 1;
+    }
+
+    priorities   = malloc(BENCH_MAX_TASKS + count);
+    picked[0]    = malloc(count);
+    picked[1]    = malloc(count);
+    push_samples = malloc(sizeof(uint32_t) * 
+                          (count > BENCH_CALIBRATION_SAMPLES ? 
+                           count : BENCH_CALIBRATION_SAMPLES));
+    pop_samples  = malloc(sizeof(uint32_t) * count);
+    if(priorities == NULL || picked[0] == NULL || picked[1] == NULL ||
+       push_samples == NULL || pop_samples == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    bench_calibrate(push_samples);
+    printf("%u elections, %u priority levels, %u ns clock overhead removed\n",
+           count, CONFIG_SCHED_PRIORITY_COUNT, bench_overhead);
+
+    mismatch = 0;
+    for(set = 0; set < BENCH_SET_COUNT; ++set)
+    {
+        /* Initial priorities of the tasks, then the requeue priorities */
+        for(i = 0; i < task_counts[set] + count; ++i)
+        {
+            priorities[i] = (uint8_t)(bench_random() %
+                                      CONFIG_SCHED_PRIORITY_COUNT);
+        }
+
+        printf("\n%u tasks\n", task_counts[set]);
+        bench_run(&queues[0], priorities, task_counts[set], count,
+                  picked[0], push_samples, pop_samples);
+        bench_run(&queues[1], priorities, task_counts[set], count,
+                  picked[1], push_samples, pop_samples);
+
+        if(memcmp(picked[0], picked[1], count) != 0)
+        {
+            printf("  Picked priorities mismatch\n");
+            ++mismatch;
+        }
+    }
+
+    free(priorities);
+    free(picked[0]);
+    free(picked[1]);
+    free(push_samples);
+    free(pop_samples);
+
+    return (mismatch != 0);
+}